@@ -0,0 +1,95 @@
+#include <benchmark/benchmark.h>
+#include <irep2/irep2.h>
+#include <irep2/irep2_utils.h>
+#include <util/crypto_hash.h>
+
+namespace
+{
+/// A balanced tree of additions over `leaves` distinct symbols
+expr2tc gen_sum(unsigned leaves)
+{
+  type2tc t = get_uint_type(32);
+  std::vector<expr2tc> level;
+  for (unsigned i = 0; i < leaves; i++)
+    level.push_back(symbol2tc(t, "x" + std::to_string(i)));
+
+  while (level.size() > 1)
+  {
+    std::vector<expr2tc> next;
+    for (size_t i = 0; i + 1 < level.size(); i += 2)
+      next.push_back(add2tc(t, level[i], level[i + 1]));
+    if (level.size() % 2)
+      next.push_back(level.back());
+    level.swap(next);
+  }
+
+  return level.front();
+}
+} // namespace
+
+static void BM_expr2tc_construct(benchmark::State &state)
+{
+  type2tc t = get_uint_type(32);
+  expr2tc x = symbol2tc(t, "x");
+  expr2tc one = gen_one(t);
+
+  for (auto _ : state)
+  {
+    expr2tc e = add2tc(t, x, one);
+    e = mul2tc(t, e, x);
+    e = greaterthan2tc(e, one);
+    benchmark::DoNotOptimize(e);
+  }
+}
+BENCHMARK(BM_expr2tc_construct);
+
+static void BM_expr2tc_clone(benchmark::State &state)
+{
+  expr2tc e = gen_sum(state.range(0));
+
+  for (auto _ : state)
+  {
+    // Detaching copies the root only, its operands stay shared
+    expr2tc copy = e->clone();
+    benchmark::DoNotOptimize(copy);
+  }
+}
+BENCHMARK(BM_expr2tc_clone)->Arg(2)->Arg(64);
+
+static void BM_expr2tc_crc(benchmark::State &state)
+{
+  expr2tc e = gen_sum(state.range(0));
+
+  for (auto _ : state)
+    benchmark::DoNotOptimize(e->crc());
+
+  state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_expr2tc_crc)->RangeMultiplier(4)->Range(4, 1024)->Complexity();
+
+static void BM_expr2tc_hash(benchmark::State &state)
+{
+  expr2tc e = gen_sum(state.range(0));
+
+  for (auto _ : state)
+  {
+    crypto_hash h;
+    e->hash(h);
+    h.fin();
+    benchmark::DoNotOptimize(h.to_size_t());
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_expr2tc_hash)->RangeMultiplier(4)->Range(4, 1024)->Complexity();
+
+static void BM_expr2tc_compare(benchmark::State &state)
+{
+  // Structurally equal, but not shared
+  expr2tc a = gen_sum(state.range(0));
+  expr2tc b = gen_sum(state.range(0));
+
+  for (auto _ : state)
+    benchmark::DoNotOptimize(a == b);
+}
+BENCHMARK(BM_expr2tc_compare)->Arg(64);
@@ -0,0 +1,81 @@
+#include <benchmark/benchmark.h>
+#include <goto-symex/renaming.h>
+#include <irep2/irep2_utils.h>
+
+namespace
+{
+/// The level2 bookkeeping without the execution state around it
+class bench_level2t : public renaming::level2t
+{
+public:
+  void rename(expr2tc &expr) override
+  {
+    renaming::level2t::rename(expr);
+  }
+
+  void rename(expr2tc &expr, unsigned count) override
+  {
+    coveredinbees(expr, count, 0);
+  }
+
+  std::shared_ptr<renaming::level2t> clone() const override
+  {
+    return std::make_shared<bench_level2t>(*this);
+  }
+};
+
+expr2tc gen_l1_symbol(const type2tc &t, unsigned i)
+{
+  return symbol2tc(t, "x" + std::to_string(i), symbol2t::level1, 1, 0, 0, 0);
+}
+} // namespace
+
+static void BM_level2_rename(benchmark::State &state)
+{
+  // `names` symbols with a current number, an expression reading `reads` of
+  // them
+  unsigned names = state.range(0);
+  unsigned reads = state.range(1);
+
+  type2tc t = get_uint_type(32);
+  bench_level2t level2;
+  for (unsigned i = 0; i < names; i++)
+  {
+    expr2tc sym = gen_l1_symbol(t, i);
+    level2.rename(sym, i + 1);
+  }
+
+  expr2tc e = gen_l1_symbol(t, 0);
+  for (unsigned i = 1; i < reads; i++)
+    e = add2tc(t, e, gen_l1_symbol(t, (i * 7919) % names));
+
+  for (auto _ : state)
+  {
+    expr2tc copy = e;
+    level2.rename(copy);
+    benchmark::DoNotOptimize(copy);
+  }
+
+  state.SetItemsProcessed(state.iterations() * reads);
+}
+BENCHMARK(BM_level2_rename)
+  ->ArgNames({"names", "reads"})
+  ->Args({16, 16})
+  ->Args({4096, 16})
+  ->Args({4096, 256});
+
+static void BM_level2_clone(benchmark::State &state)
+{
+  // Copied on every branch of the reachability tree
+  type2tc t = get_uint_type(32);
+  bench_level2t level2;
+  for (unsigned i = 0; i < state.range(0); i++)
+  {
+    expr2tc sym = gen_l1_symbol(t, i);
+    level2.rename(sym, 1);
+  }
+
+  for (auto _ : state)
+    benchmark::DoNotOptimize(level2.clone());
+}
+BENCHMARK(BM_level2_clone)->Arg(256)->Arg(4096);
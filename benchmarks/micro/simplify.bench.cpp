@@ -0,0 +1,102 @@
+#include <benchmark/benchmark.h>
+#include <irep2/irep2.h>
+#include <irep2/irep2_utils.h>
+
+namespace
+{
+/// Representative shapes of what symex hands to the simplifier
+enum shapet
+{
+  ARITH_IDENTITY, // (x + 0) * 1 - 0
+  CONST_FOLD,     // (3 + 4) * x + (2 * 5)
+  BOOL_GUARD,     // g1 && (true || g2) && !(!g3)
+  BIT_MASK,       // (x & 0xff) | (x & 0xff00) >> 0
+  CAST_CHAIN,     // (uint32)(uint64)(uint32) x
+  ITE_CONST,      // (1 == 1) ? x : y
+  INDEX_CONST,    // {1, 2, 3, 4}[2]
+  WITH_INDEX      // (a WITH [1] := x)[1]
+};
+
+expr2tc gen_shape(shapet shape)
+{
+  type2tc u32 = get_uint_type(32);
+  type2tc u64 = get_uint_type(64);
+  type2tc b = get_bool_type();
+  expr2tc x = symbol2tc(u32, "x");
+  expr2tc y = symbol2tc(u32, "y");
+  auto c = [&u32](unsigned v) { return constant_int2tc(u32, BigInt(v)); };
+
+  switch (shape)
+  {
+  case ARITH_IDENTITY:
+    return sub2tc(u32, mul2tc(u32, add2tc(u32, x, c(0)), c(1)), c(0));
+  case CONST_FOLD:
+    return add2tc(
+      u32, mul2tc(u32, add2tc(u32, c(3), c(4)), x), mul2tc(u32, c(2), c(5)));
+  case BOOL_GUARD:
+    return and2tc(
+      and2tc(symbol2tc(b, "g1"), or2tc(gen_true_expr(), symbol2tc(b, "g2"))),
+      not2tc(not2tc(symbol2tc(b, "g3"))));
+  case BIT_MASK:
+    return bitor2tc(
+      u32,
+      bitand2tc(u32, x, c(0xff)),
+      lshr2tc(u32, bitand2tc(u32, x, c(0xff00)), c(0)));
+  case CAST_CHAIN:
+    return typecast2tc(u32, typecast2tc(u64, typecast2tc(u32, x)));
+  case ITE_CONST:
+    return if2tc(u32, equality2tc(c(1), c(1)), x, y);
+  case INDEX_CONST:
+  {
+    type2tc arr = array_type2tc(u32, c(4), false);
+    expr2tc a =
+      constant_array2tc(arr, std::vector<expr2tc>{c(1), c(2), c(3), c(4)});
+    return index2tc(u32, a, c(2));
+  }
+  case WITH_INDEX:
+  {
+    type2tc arr = array_type2tc(u32, c(4), false);
+    expr2tc a = symbol2tc(arr, "a");
+    return index2tc(u32, with2tc(arr, a, c(1), x), c(1));
+  }
+  }
+
+  abort();
+}
+} // namespace
+
+static void BM_simplify(benchmark::State &state)
+{
+  const expr2tc e = gen_shape(static_cast<shapet>(state.range(0)));
+
+  for (auto _ : state)
+  {
+    expr2tc copy = e;
+    simplify(copy);
+    benchmark::DoNotOptimize(copy);
+  }
+}
+BENCHMARK(BM_simplify)
+  ->ArgName("shape")
+  ->DenseRange(ARITH_IDENTITY, WITH_INDEX);
+
+static void BM_simplify_nothing(benchmark::State &state)
+{
+  // A deep expression the simplifier can do nothing about
+  type2tc u32 = get_uint_type(32);
+  expr2tc e = symbol2tc(u32, "x0");
+  for (unsigned i = 1; i < 64; i++)
+  {
+    std::string n = std::to_string(i);
+    e = add2tc(
+      u32, mul2tc(u32, e, symbol2tc(u32, "x" + n)), symbol2tc(u32, "y" + n));
+  }
+
+  for (auto _ : state)
+  {
+    expr2tc copy = e;
+    simplify(copy);
+    benchmark::DoNotOptimize(copy);
+  }
+}
+BENCHMARK(BM_simplify_nothing);
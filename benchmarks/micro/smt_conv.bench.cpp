@@ -0,0 +1,279 @@
+#include <benchmark/benchmark.h>
+#include <irep2/irep2_utils.h>
+#include <memory>
+#include <solvers/smt/array_conv.h>
+#include <solvers/smt/fp/fp_conv.h>
+#include <solvers/smt/smt_conv.h>
+#include <solvers/smt/tuple/smt_tuple_node.h>
+#include <util/context.h>
+#include <util/namespace.h>
+#include <util/options.h>
+
+namespace
+{
+class stub_smt_ast : public smt_ast
+{
+public:
+  using smt_ast::smt_ast;
+};
+
+/// A solver that builds empty terms of the right sort and solves nothing, so
+/// what is measured is smt_convt itself
+class stub_convt : public smt_convt
+{
+public:
+  stub_convt(const namespacet &ns, const optionst &options)
+    : smt_convt(ns, options)
+  {
+  }
+
+  ~stub_convt() override
+  {
+    delete_all_asts();
+  }
+
+  void assert_ast(smt_astt) override
+  {
+  }
+
+  resultt dec_solve() override
+  {
+    return P_ERROR;
+  }
+
+  const std::string solver_text() override
+  {
+    return "stub";
+  }
+
+  smt_astt mk_smt_int(const BigInt &) override
+  {
+    return term(mk_int_sort());
+  }
+
+  smt_astt mk_smt_real(const std::string &) override
+  {
+    return term(mk_real_sort());
+  }
+
+  smt_astt mk_smt_bv(const BigInt &, smt_sortt s) override
+  {
+    return term(s);
+  }
+
+  smt_astt mk_smt_bool(bool) override
+  {
+    return term(boolean_sort);
+  }
+
+  smt_astt mk_smt_symbol(const std::string &, smt_sortt s) override
+  {
+    return term(s);
+  }
+
+  smt_astt mk_extract(smt_astt, unsigned int high, unsigned int low) override
+  {
+    return term(mk_bv_sort(high - low + 1));
+  }
+
+  smt_astt mk_sign_ext(smt_astt a, unsigned int topwidth) override
+  {
+    return term(mk_bv_sort(a->sort->get_data_width() + topwidth));
+  }
+
+  smt_astt mk_zero_ext(smt_astt a, unsigned int topwidth) override
+  {
+    return term(mk_bv_sort(a->sort->get_data_width() + topwidth));
+  }
+
+  smt_astt mk_concat(smt_astt a, smt_astt b) override
+  {
+    return term(
+      mk_bv_sort(a->sort->get_data_width() + b->sort->get_data_width()));
+  }
+
+  smt_astt mk_ite(smt_astt, smt_astt t, smt_astt) override
+  {
+    return term(t->sort);
+  }
+
+  bool get_bool(smt_astt) override
+  {
+    return false;
+  }
+
+  BigInt get_bv(smt_astt, bool) override
+  {
+    return 0;
+  }
+
+#define STUB_SAME_SORT(name)                                                   \
+  smt_astt name(smt_astt a, smt_astt) override                                 \
+  {                                                                            \
+    return term(a->sort);                                                      \
+  }
+#define STUB_BOOL(name)                                                        \
+  smt_astt name(smt_astt, smt_astt) override                                   \
+  {                                                                            \
+    return term(boolean_sort);                                                 \
+  }
+
+  STUB_SAME_SORT(mk_bvadd)
+  STUB_SAME_SORT(mk_bvsub)
+  STUB_SAME_SORT(mk_bvmul)
+  STUB_SAME_SORT(mk_bvsmod)
+  STUB_SAME_SORT(mk_bvumod)
+  STUB_SAME_SORT(mk_bvsdiv)
+  STUB_SAME_SORT(mk_bvudiv)
+  STUB_SAME_SORT(mk_bvshl)
+  STUB_SAME_SORT(mk_bvashr)
+  STUB_SAME_SORT(mk_bvlshr)
+  STUB_SAME_SORT(mk_bvxor)
+  STUB_SAME_SORT(mk_bvor)
+  STUB_SAME_SORT(mk_bvand)
+  STUB_BOOL(mk_implies)
+  STUB_BOOL(mk_xor)
+  STUB_BOOL(mk_or)
+  STUB_BOOL(mk_and)
+  STUB_BOOL(mk_bvult)
+  STUB_BOOL(mk_bvslt)
+  STUB_BOOL(mk_bvugt)
+  STUB_BOOL(mk_bvsgt)
+  STUB_BOOL(mk_bvule)
+  STUB_BOOL(mk_bvsle)
+  STUB_BOOL(mk_bvuge)
+  STUB_BOOL(mk_bvsge)
+  STUB_BOOL(mk_eq)
+  STUB_BOOL(mk_neq)
+
+#undef STUB_SAME_SORT
+#undef STUB_BOOL
+
+  smt_astt mk_bvneg(smt_astt a) override
+  {
+    return term(a->sort);
+  }
+
+  smt_astt mk_bvnot(smt_astt a) override
+  {
+    return term(a->sort);
+  }
+
+  smt_astt mk_not(smt_astt) override
+  {
+    return term(boolean_sort);
+  }
+
+  smt_sortt mk_bool_sort() override
+  {
+    return sort(SMT_SORT_BOOL, 1);
+  }
+
+  smt_sortt mk_int_sort() override
+  {
+    return sort(SMT_SORT_INT, 0);
+  }
+
+  smt_sortt mk_real_sort() override
+  {
+    return sort(SMT_SORT_REAL, 0);
+  }
+
+  smt_sortt mk_bv_sort(std::size_t width) override
+  {
+    return sort(SMT_SORT_BV, width);
+  }
+
+  smt_sortt mk_fbv_sort(std::size_t width) override
+  {
+    return sort(SMT_SORT_FIXEDBV, width);
+  }
+
+protected:
+  smt_astt term(smt_sortt s)
+  {
+    return new stub_smt_ast(this, s);
+  }
+
+  smt_sortt sort(smt_sort_kind kind, std::size_t width)
+  {
+    auto &s = sorts[{kind, width}];
+    if (!s)
+      s = kind == SMT_SORT_BV || kind == SMT_SORT_FIXEDBV
+            ? std::make_unique<smt_sort>(kind, width)
+            : std::make_unique<smt_sort>(kind);
+    return s.get();
+  }
+
+  std::map<std::pair<smt_sort_kind, std::size_t>, std::unique_ptr<smt_sort>>
+    sorts;
+};
+
+/// A solver set up as create_solver() would, on top of the stub
+struct stub_solvert
+{
+  contextt context;
+  namespacet ns{context};
+  optionst options;
+  std::unique_ptr<stub_convt> conv;
+
+  stub_solvert()
+  {
+    conv = std::make_unique<stub_convt>(ns, options);
+    conv->set_tuple_iface(new smt_tuple_node_flattener(conv.get(), ns));
+    conv->set_array_iface(new array_convt(conv.get()));
+    conv->set_fp_conv(new fp_convt(conv.get()));
+    conv->smt_post_init();
+  }
+};
+
+/// The shape of an unrolled loop body: x_i+1 = c_i ? x_i * k + i : x_i - i
+expr2tc gen_formula(unsigned steps)
+{
+  type2tc t = get_uint_type(32);
+  type2tc b = get_bool_type();
+  expr2tc x = symbol2tc(t, "x0");
+  expr2tc k = symbol2tc(t, "k");
+  expr2tc res = gen_true_expr();
+
+  for (unsigned i = 1; i <= steps; i++)
+  {
+    expr2tc n = constant_int2tc(t, BigInt(i));
+    expr2tc c = symbol2tc(b, "c" + std::to_string(i));
+    expr2tc next = symbol2tc(t, "x" + std::to_string(i));
+    expr2tc rhs = if2tc(t, c, add2tc(t, mul2tc(t, x, k), n), sub2tc(t, x, n));
+    res = and2tc(res, equality2tc(next, rhs));
+    x = next;
+  }
+
+  return and2tc(res, lessthan2tc(x, symbol2tc(t, "bound")));
+}
+} // namespace
+
+static void BM_smt_convert_ast(benchmark::State &state)
+{
+  stub_solvert solver;
+  expr2tc e = gen_formula(state.range(0));
+
+  for (auto _ : state)
+  {
+    // Converting in a context of its own so that nothing stays cached
+    solver.conv->push_ctx();
+    benchmark::DoNotOptimize(solver.conv->convert_ast(e));
+    solver.conv->pop_ctx();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_smt_convert_ast)->Arg(16)->Arg(256);
+
+static void BM_smt_convert_ast_cached(benchmark::State &state)
+{
+  stub_solvert solver;
+  expr2tc e = gen_formula(16);
+  solver.conv->convert_ast(e);
+
+  for (auto _ : state)
+    benchmark::DoNotOptimize(solver.conv->convert_ast(e));
+}
+BENCHMARK(BM_smt_convert_ast_cached);
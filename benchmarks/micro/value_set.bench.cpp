@@ -0,0 +1,48 @@
+#include <benchmark/benchmark.h>
+#include <irep2/irep2_utils.h>
+#include <pointer-analysis/value_set.h>
+#include <util/context.h>
+#include <util/migrate.h>
+#include <util/namespace.h>
+
+static void BM_value_set_get(benchmark::State &state)
+{
+  // p0 .. pn-1 each point at one of `objects` integers, q may be any of them
+  unsigned objects = state.range(0);
+
+  contextt context;
+  namespacet ns(context);
+  value_sett vs(ns);
+
+  type2tc t = get_int_type(32);
+  type2tc ptr = pointer_type2tc(t);
+  // The value set looks up the symbols it points at
+  auto sym = [&context](const type2tc &type, const std::string &name) {
+    symbolt s;
+    s.id = name;
+    s.name = name;
+    s.type = migrate_type_back(type);
+    context.add(s);
+    return symbol2tc(type, name, symbol2t::level1, 1, 0, 0, 0);
+  };
+
+  expr2tc q = sym(ptr, "q");
+  for (unsigned i = 0; i < objects; i++)
+  {
+    expr2tc p = sym(ptr, "p" + std::to_string(i));
+    vs.assign(p, address_of2tc(t, sym(t, "x" + std::to_string(i))));
+    vs.assign(q, p, true);
+  }
+
+  // The pointer symex dereferences: an offset from a choice of two
+  expr2tc cond = sym(get_bool_type(), "c");
+  expr2tc e = add2tc(ptr, if2tc(ptr, cond, q, sym(ptr, "p0")), gen_one(t));
+
+  for (auto _ : state)
+  {
+    value_setst::valuest dest;
+    vs.get_value_set(e, dest);
+    benchmark::DoNotOptimize(dest);
+  }
+}
+BENCHMARK(BM_value_set_get)->Arg(4)->Arg(64);
@@ -0,0 +1,258 @@
+#!/usr/bin/env python3
+# -*- coding: UTF-8 -*-
+
+import argparse
+import json
+import os
+import platform
+import re
+import shlex
+import statistics
+import subprocess
+import sys
+import tempfile
+
+#####################
+# Benchmark runner
+#####################
+
+# Summary
+# - Runs every case of the suite a number of times with --perf-report and
+#   summarises each metric by its median and its median absolute deviation
+#   (MAD) over the runs.
+# - Compares the summary against a stored baseline and fails if a gated
+#   metric got slower or bigger by more than the noise allows.
+# - Cases use the test.desc format of the regression suites; their expected
+#   output is checked on every run, so a benchmark that stopped verifying
+#   fails instead of getting faster.
+
+# Metrics
+# cpu               CPU time of the whole run, in seconds
+# wall              wall time of the whole run, in seconds
+# peak_rss          peak resident set size of the run, in KiB
+# phase:<name>      CPU time of one phase (see --perf-report), in seconds
+GATED_BY_DEFAULT = ["cpu", "peak_rss", "phase:"]
+
+# Exit code when there is no baseline to compare against; ctest reports the
+# test as skipped rather than passed
+NO_BASELINE = 77
+
+
+class BenchmarkCase:
+    """A benchmark program with its arguments and expected output"""
+
+    def __init__(self, case_dir: str):
+        self.name = os.path.basename(case_dir)
+        self.case_dir = case_dir
+        with open(os.path.join(case_dir, "test.desc")) as fp:
+            self.mode = fp.readline().strip()
+            self.file = fp.readline().strip()
+            self.args = fp.readline().strip()
+            self.regex = [line.strip() for line in fp if line.strip()]
+
+    def command(self, tool, report):
+        cmd = list(tool)
+        cmd.append(os.path.join(self.case_dir, self.file))
+        cmd.extend(shlex.split(self.args))
+        cmd.extend(["--perf-report", report])
+        return cmd
+
+    def check_output(self, output: str):
+        for r in self.regex:
+            if not re.search(r, output, re.MULTILINE):
+                return r
+        return None
+
+
+def run_once(case: BenchmarkCase, tool, timeout):
+    """Run the case once, returns its metrics or raises RuntimeError"""
+    fd, report = tempfile.mkstemp(suffix=".json")
+    os.close(fd)
+    try:
+        cmd = case.command(tool, report)
+        try:
+            p = subprocess.run(cmd, stdout=subprocess.PIPE,
+                               stderr=subprocess.STDOUT, timeout=timeout)
+        except subprocess.TimeoutExpired:
+            raise RuntimeError("timed out")
+
+        output = p.stdout.decode(errors="replace")
+        missing = case.check_output(output)
+        if missing:
+            raise RuntimeError(
+                f"expected output `{missing}' not found, got:\n{output}")
+
+        with open(report) as fp:
+            data = json.load(fp)
+    finally:
+        os.remove(report)
+
+    metrics = {
+        "cpu": data["total"]["cpu"],
+        "wall": data["total"]["wall"],
+        "peak_rss": data["total"]["peak_rss"],
+    }
+    for phase in data["phases"]:
+        metrics["phase:" + phase["name"]] = phase["cpu"]
+    return metrics, data["counters"]
+
+
+def summarise(samples):
+    median = statistics.median(samples)
+    mad = statistics.median([abs(x - median) for x in samples])
+    return {"median": median, "mad": mad, "samples": samples}
+
+
+def run_case(case: BenchmarkCase, tool, repeat, warmup, timeout):
+    for _ in range(warmup):
+        run_once(case, tool, timeout)
+
+    runs = []
+    counters = {}
+    for _ in range(repeat):
+        metrics, counters = run_once(case, tool, timeout)
+        runs.append(metrics)
+
+    # A phase that did not run in some repetition took no time there
+    names = sorted(set().union(*runs))
+    result = {n: summarise([r.get(n, 0.0) for r in runs]) for n in names}
+    return {"metrics": result, "counters": counters}
+
+
+def is_gated(metric, gated):
+    return any(metric == g or (g.endswith(":") and metric.startswith(g))
+               for g in gated)
+
+
+def compare(results, baseline, args):
+    """Returns the list of regressions, printing every change on the way"""
+    regressions = []
+    for case, current in sorted(results.items()):
+        if case not in baseline["cases"]:
+            print(f"{case}: not in the baseline")
+            continue
+
+        base_metrics = baseline["cases"][case]["metrics"]
+        for metric, cur in sorted(current["metrics"].items()):
+            if metric not in base_metrics:
+                continue
+
+            base = base_metrics[metric]
+            floor = args.mem_floor if metric == "peak_rss" else args.time_floor
+            # Allow the relative tolerance plus whatever the measurements
+            # themselves show to be noise, but never less than the floor
+            noise = max(floor, args.noise_factor * max(base["mad"], cur["mad"]))
+            limit = base["median"] * (1 + args.tolerance) + noise
+            better = base["median"] * (1 - args.tolerance) - noise
+
+            change = f"{base['median']:.3f} -> {cur['median']:.3f}"
+            if cur["median"] > limit:
+                gated = is_gated(metric, args.gate)
+                print(f"{case}: {metric} regressed ({change})"
+                      + ("" if gated else " [not gated]"))
+                if gated:
+                    regressions.append((case, metric))
+            elif cur["median"] < better:
+                print(f"{case}: {metric} improved ({change})")
+
+    return regressions
+
+
+def machine():
+    return {"system": platform.system(), "machine": platform.machine(),
+            "processor": platform.processor(), "cpus": os.cpu_count()}
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(
+        description="Run the performance benchmarks of ESBMC and compare "
+                    "them against a baseline")
+    parser.add_argument("--tool", required=True,
+                        help="tool executable path + optional args")
+    parser.add_argument("--suite", default=os.path.join(here, "suite"),
+                        help="directory of benchmark cases")
+    parser.add_argument("--baseline", default=os.path.join(here, "baseline.json"),
+                        help="baseline to compare against or to update")
+    parser.add_argument("--update-baseline", action="store_true",
+                        help="store the results as the new baseline")
+    parser.add_argument("--output", help="also write the results here")
+    parser.add_argument("--cases", nargs="+", help="only run these cases")
+    parser.add_argument("--repeat", type=int, default=5,
+                        help="measured runs per case (default: 5)")
+    parser.add_argument("--warmup", type=int, default=1,
+                        help="unmeasured runs per case (default: 1)")
+    parser.add_argument("--timeout", type=float, default=600,
+                        help="timeout of a single run in seconds")
+    parser.add_argument("--tolerance", type=float, default=0.10,
+                        help="relative change allowed (default: 0.10)")
+    parser.add_argument("--time-floor", type=float, default=0.05,
+                        help="absolute change in seconds always allowed")
+    parser.add_argument("--mem-floor", type=float, default=8192,
+                        help="absolute change in KiB always allowed")
+    parser.add_argument("--noise-factor", type=float, default=3.0,
+                        help="how many MADs of a metric count as noise")
+    parser.add_argument("--gate", nargs="+", default=GATED_BY_DEFAULT,
+                        help="metrics that fail the run when they regress; "
+                             "a name ending in ':' matches a prefix")
+    args = parser.parse_args()
+
+    tool = shlex.split(args.tool)
+    cases = [BenchmarkCase(os.path.join(args.suite, d))
+             for d in sorted(os.listdir(args.suite))
+             if os.path.isfile(os.path.join(args.suite, d, "test.desc"))]
+    if args.cases:
+        cases = [c for c in cases if c.name in args.cases]
+
+    results = {}
+    failed = False
+    for case in cases:
+        try:
+            results[case.name] = run_case(case, tool, args.repeat,
+                                          args.warmup, args.timeout)
+            m = results[case.name]["metrics"]
+            print(f"{case.name}: cpu {m['cpu']['median']:.3f}s, "
+                  f"wall {m['wall']['median']:.3f}s, "
+                  f"peak {m['peak_rss']['median'] / 1024:.1f}MiB")
+        except RuntimeError as e:
+            print(f"{case.name}: FAILED: {e}")
+            failed = True
+
+    report = {"machine": machine(), "repeat": args.repeat, "cases": results}
+    if args.output:
+        with open(args.output, "w") as fp:
+            json.dump(report, fp, indent=2)
+
+    if failed:
+        return 2
+
+    if args.update_baseline:
+        with open(args.baseline, "w") as fp:
+            json.dump(report, fp, indent=2)
+        print(f"Baseline written to {args.baseline}")
+        return 0
+
+    if not os.path.exists(args.baseline):
+        # Nothing was compared, which must not look like a pass
+        print(f"No baseline at {args.baseline}, run with --update-baseline "
+              "to create one")
+        return NO_BASELINE
+
+    with open(args.baseline) as fp:
+        baseline = json.load(fp)
+
+    if baseline.get("machine") != machine():
+        print("warning: the baseline was recorded on a different machine: "
+              f"{baseline.get('machine')}")
+
+    regressions = compare(results, baseline, args)
+    if regressions:
+        print(f"{len(regressions)} metric(s) regressed")
+        return 1
+
+    print("No performance regressions")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,58 @@
+#include <cassert>
+
+template <typename T, int N>
+class ring_buffer
+{
+public:
+  bool push(const T &v)
+  {
+    if (size == N)
+      return false;
+    data[(start + size++) % N] = v;
+    return true;
+  }
+
+  bool pop(T &v)
+  {
+    if (size == 0)
+      return false;
+    v = data[start];
+    start = (start + 1) % N;
+    size--;
+    return true;
+  }
+
+private:
+  T data[N];
+  int start = 0;
+  int size = 0;
+};
+
+int nondet_int();
+
+int main()
+{
+  ring_buffer<int, 4> rb;
+  int pushed = 0, popped = 0;
+
+  for (int i = 0; i < 10; i++)
+  {
+    if (nondet_int())
+    {
+      if (rb.push(pushed))
+        pushed++;
+    }
+    else
+    {
+      int v;
+      if (rb.pop(v))
+      {
+        assert(v == popped);
+        popped++;
+      }
+    }
+  }
+
+  assert(popped <= pushed);
+  return 0;
+}
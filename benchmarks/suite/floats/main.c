@@ -0,0 +1,18 @@
+#include <math.h>
+
+float nondet_float();
+
+int main()
+{
+  float x = nondet_float();
+  __ESBMC_assume(x >= 1.0f && x <= 100.0f);
+
+  // A few steps of Newton's method for the square root of x
+  float r = x / 2.0f;
+  for (int i = 0; i < 6; i++)
+    r = 0.5f * (r + x / r);
+
+  __ESBMC_assert(r > 0.0f, "positive");
+  __ESBMC_assert(fabsf(r * r - x) < 1.0f, "close to the square root");
+  return 0;
+}
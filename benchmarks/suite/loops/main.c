@@ -0,0 +1,28 @@
+#define N 24
+
+int nondet_int();
+
+int main()
+{
+  int a[N];
+  for (int i = 0; i < N; i++)
+  {
+    a[i] = nondet_int();
+    __ESBMC_assume(a[i] >= 0 && a[i] < 1000);
+  }
+
+  // Bubble sort, then check the result is ordered
+  for (int i = 0; i < N; i++)
+    for (int j = 0; j + 1 < N - i; j++)
+      if (a[j] > a[j + 1])
+      {
+        int t = a[j];
+        a[j] = a[j + 1];
+        a[j + 1] = t;
+      }
+
+  for (int i = 0; i + 1 < N; i++)
+    __ESBMC_assert(a[i] <= a[i + 1], "sorted");
+
+  return 0;
+}
@@ -0,0 +1,22 @@
+int nondet_int();
+
+int a[8];
+
+int main()
+{
+  int n = nondet_int();
+  __ESBMC_assume(n >= 0 && n <= 8);
+
+  for (int i = 0; i < n; i++)
+    a[i] = i * i;
+
+  int sum = 0;
+  for (int i = 0; i < n; i++)
+    sum += a[i];
+
+  __ESBMC_assert(sum >= 0, "sum is not negative");
+  __ESBMC_assert(n < 8 || sum == 140, "sum of the first eight squares");
+  __ESBMC_assert(sum < 100, "fails for n = 8");
+  __ESBMC_assert(n == 0 || a[n - 1] == (n - 1) * (n - 1), "last square");
+  return 0;
+}
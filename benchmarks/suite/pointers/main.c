@@ -0,0 +1,57 @@
+#include <stdlib.h>
+
+struct node
+{
+  int value;
+  struct node *next;
+};
+
+int nondet_int();
+
+int main()
+{
+  struct node *head = NULL;
+  int n = 0;
+
+  for (int i = 0; i < 12; i++)
+  {
+    if (nondet_int())
+      continue;
+
+    struct node *n_new = malloc(sizeof(struct node));
+    if (!n_new)
+      break;
+    n_new->value = i;
+    n_new->next = head;
+    head = n_new;
+    n++;
+  }
+
+  // Reverse the list in place
+  struct node *prev = NULL;
+  while (head)
+  {
+    struct node *next = head->next;
+    head->next = prev;
+    prev = head;
+    head = next;
+  }
+
+  int count = 0, last = -1;
+  for (struct node *p = prev; p; p = p->next)
+  {
+    __ESBMC_assert(p->value > last, "increasing after reversal");
+    last = p->value;
+    count++;
+  }
+  __ESBMC_assert(count == n, "no node lost");
+
+  while (prev)
+  {
+    struct node *next = prev->next;
+    free(prev);
+    prev = next;
+  }
+
+  return 0;
+}
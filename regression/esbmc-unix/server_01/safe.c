@@ -0,0 +1,10 @@
+#include <assert.h>
+
+int main()
+{
+  int s = 0;
+  for (int i = 0; i < 3; i++)
+    s += i;
+  assert(s == 3);
+  return 0;
+}
@@ -0,0 +1,19 @@
+#include <assert.h>
+
+#define SIZE 4096
+
+unsigned int nondet_uint();
+
+unsigned int buf[SIZE];
+
+int main()
+{
+  unsigned int head = nondet_uint() % SIZE;
+  unsigned int i = nondet_uint() % 8;
+
+  for (unsigned int k = 0; k < 8; k++)
+    buf[(head + k) % SIZE] = k;
+
+  assert(buf[(head + i) % SIZE] != 7);
+  return 0;
+}
@@ -0,0 +1,33 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct header
+{
+  uint8_t version;
+  uint8_t flags;
+  uint16_t length;
+  uint32_t seq;
+};
+
+int main()
+{
+  uint8_t raw[8] = {1, 0x80, 0x34, 0x12, 0x78, 0x56, 0x34, 0x12};
+  struct header *h = malloc(sizeof(struct header));
+  if (!h)
+    return 0;
+
+  memcpy(h, raw, sizeof(raw));
+  assert(h->version == 1);
+  assert(h->flags == 0x80);
+  assert(h->length == 0x1234);
+  assert(h->seq == 0x12345678);
+
+  h->length = 0xabcd;
+  assert(((uint8_t *)h)[2] == 0xcd);
+  assert(((uint8_t *)h)[3] == 0xab);
+
+  free(h);
+  return 0;
+}
@@ -0,0 +1,19 @@
+#include <stdlib.h>
+
+unsigned int nondet_uint();
+
+int main()
+{
+  int *a = malloc(4 * sizeof(int));
+  if (!a)
+    return 0;
+
+  unsigned int i = nondet_uint();
+  if (i > 4)
+    return 0;
+
+  // Out of bounds for i == 4
+  a[i] = 1;
+  free(a);
+  return 0;
+}
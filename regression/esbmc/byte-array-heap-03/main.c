@@ -0,0 +1,35 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+struct pair
+{
+  uint16_t lo;
+  uint16_t hi;
+};
+
+unsigned int nondet_uint();
+
+int main()
+{
+  // Only accessed as ints: keeps typed storage
+  int *a = malloc(8 * sizeof(int));
+  // Also accessed as bytes: stored as bytes
+  struct pair *p = malloc(sizeof(struct pair));
+  if (!a || !p)
+    return 0;
+
+  unsigned int i = nondet_uint();
+  __ESBMC_assume(i < 8);
+  a[i] = 42;
+  assert(a[i] == 42);
+
+  p->lo = 0x1234;
+  p->hi = 0x5678;
+  uint8_t *bytes = (uint8_t *)p;
+  assert(bytes[0] == 0x34 && bytes[3] == 0x56);
+
+  free(a);
+  free(p);
+  return 0;
+}
@@ -0,0 +1,21 @@
+int *p;
+
+int get(void)
+{
+  return *p;
+}
+
+void set(void)
+{
+  int x = 1;
+  p = &x;
+  // p points to a live variable here
+  get();
+}
+
+int main()
+{
+  set();
+  // The same dereference with the same value set, but x has expired
+  return get();
+}
@@ -0,0 +1,21 @@
+#include <assert.h>
+
+int nondet_int();
+
+int main()
+{
+  int n = nondet_int();
+  __ESBMC_assume(n >= 0 && n < 1000000);
+
+  int x = 1;
+  int y = 0;
+  for (int i = 0; i < n; i++)
+  {
+    x += 2;
+    y -= 3;
+  }
+
+  assert(x == 2 * n + 1);
+  assert(y == -3 * n);
+  return 0;
+}
@@ -0,0 +1,22 @@
+#include <assert.h>
+
+int nondet_int();
+
+int sum(int n)
+{
+  int a[n];
+  int s = 0;
+  for (int i = 0; i < n; i++)
+    a[i] = i;
+  for (int i = 0; i < n; i += 2)
+    s += a[i];
+  return s;
+}
+
+int main()
+{
+  int n = nondet_int();
+  __ESBMC_assume(n > 0 && n < 5);
+  assert(sum(n) < 2);
+  return 0;
+}
@@ -0,0 +1,22 @@
+#include <assert.h>
+#include <string.h>
+
+struct header
+{
+  char magic[4];
+  int length;
+};
+
+int main()
+{
+  char a[64] = "hello", b[64] = "help";
+  assert(memcmp(a, b, 3) == 0);
+  assert(memcmp(a, b, 4) < 0);
+  assert(memcmp(b, a, 64) > 0);
+
+  struct header h1 = {"ESBM", 10}, h2 = h1;
+  assert(memcmp(&h1, &h2, sizeof(h1)) == 0);
+  h2.length = 11;
+  assert(memcmp(&h1, &h2, sizeof(h1)) != 0);
+  return 0;
+}
@@ -0,0 +1,22 @@
+#include <assert.h>
+#include <string.h>
+
+struct packet
+{
+  int id;
+  char payload[60];
+};
+
+int main()
+{
+  int src[100], dst[100];
+  for (int i = 0; i < 100; i += 25)
+    src[i] = i;
+  memcpy(dst, src, sizeof(src));
+  assert(dst[0] == 0 && dst[75] == 75);
+
+  struct packet a = {42, "hello"}, b;
+  memcpy(&b, &a, sizeof(a));
+  assert(b.id == 42 && b.payload[4] == 'o');
+  return 0;
+}
@@ -0,0 +1,15 @@
+#include <assert.h>
+#include <string.h>
+
+int main()
+{
+  int a[64];
+  a[0] = 1;
+  a[1] = 2;
+  a[2] = 3;
+  memmove(&a[1], &a[0], 32 * sizeof(int));
+  assert(a[1] == 1 && a[2] == 2 && a[3] == 3);
+  memmove(&a[0], &a[1], 3 * sizeof(int));
+  assert(a[0] == 1 && a[1] == 2 && a[2] == 3);
+  return 0;
+}
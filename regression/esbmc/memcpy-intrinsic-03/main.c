@@ -0,0 +1,9 @@
+#include <string.h>
+
+int main()
+{
+  int src[8] = {0};
+  int dst[4];
+  memcpy(dst, src, sizeof(src));
+  return dst[0];
+}
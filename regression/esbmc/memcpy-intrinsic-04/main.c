@@ -0,0 +1,29 @@
+#include <assert.h>
+#include <string.h>
+
+unsigned int nondet_uint();
+
+int main()
+{
+  int src[64], dst[64];
+  unsigned int n = nondet_uint();
+  __ESBMC_assume(n >= 2 && n <= 64);
+
+  src[0] = 7;
+  src[1] = 8;
+  dst[63] = 5;
+  memcpy(dst, src, n * sizeof(int));
+  assert(dst[0] == 7 && dst[1] == 8);
+  assert(n == 64 || dst[63] == 5);
+
+  memmove(&dst[1], &dst[0], (n - 1) * sizeof(int));
+  assert(dst[1] == 7 && dst[2] == 8);
+
+  char buf[32];
+  unsigned int k = nondet_uint();
+  __ESBMC_assume(k <= sizeof(buf));
+  buf[3] = 'b';
+  memset(buf, 'a', k);
+  assert(buf[3] == (k > 3 ? 'a' : 'b'));
+  return 0;
+}
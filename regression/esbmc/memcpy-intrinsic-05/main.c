@@ -0,0 +1,13 @@
+#include <string.h>
+
+unsigned int nondet_uint();
+
+int main()
+{
+  int src[8] = {0};
+  int dst[4];
+  unsigned int n = nondet_uint();
+  __ESBMC_assume(n <= 8);
+  memcpy(dst, src, n * sizeof(int));
+  return dst[0];
+}
@@ -0,0 +1,21 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+int main()
+{
+  int *p = malloc(sizeof(int));
+  if (!p)
+    return 0;
+  uintptr_t old = (uintptr_t)p;
+  free(p);
+
+  int *q = malloc(sizeof(int));
+  if (!q)
+    return 0;
+
+  // Fails when q reuses the memory of p. The ordered address space places q
+  // after p, so it does not find this violation yet.
+  assert((uintptr_t)q != old);
+  return 0;
+}
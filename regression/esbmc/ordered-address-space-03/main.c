@@ -0,0 +1,20 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+int main()
+{
+  int *p = malloc(sizeof(int));
+  if (!p)
+    return 0;
+  uintptr_t old = (uintptr_t)p;
+  free(p);
+
+  int *q = malloc(sizeof(int));
+  if (!q)
+    return 0;
+
+  // Fails when q reuses the memory of p
+  assert((uintptr_t)q != old);
+  return 0;
+}
@@ -0,0 +1,30 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+int a, b;
+
+int main()
+{
+  uintptr_t x = (uintptr_t)&a, y = (uintptr_t)&b;
+  assert(x != y);
+
+  int *p = (int *)x;
+  *p = 1;
+  assert(a == 1);
+
+  int *q[8];
+  for (int i = 0; i < 8; i++)
+  {
+    q[i] = malloc(sizeof(int));
+    if (!q[i])
+      return 0;
+    *q[i] = i;
+  }
+
+  // Objects never overlap
+  assert((uintptr_t)q[3] + sizeof(int) <= (uintptr_t)q[4] ||
+         (uintptr_t)q[4] + sizeof(int) <= (uintptr_t)q[3]);
+  assert(*q[3] == 3 && *q[4] == 4);
+  return 0;
+}
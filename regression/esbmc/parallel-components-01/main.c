@@ -0,0 +1,17 @@
+#include <assert.h>
+
+int nondet_int();
+
+/* Two subsystems that share no state: the sensor filter is correct, the
+ * actuator clamp is off by one. */
+int main()
+{
+  int sample = nondet_int();
+  int filtered = sample > 100 ? 100 : sample;
+  assert(filtered <= 100);
+
+  int command = nondet_int();
+  int clamped = command < 0 ? 0 : command > 255 ? 256 : command;
+  assert(clamped <= 255);
+  return 0;
+}
@@ -0,0 +1,16 @@
+#include <assert.h>
+
+int nondet_int();
+
+int main()
+{
+  int a = nondet_int();
+  int b = nondet_int();
+  assert(a + 0 == a);
+
+  /* The claim on b follows an infeasible assumption on an unrelated
+   * variable, so it must not be solved on its own. */
+  __ESBMC_assume(a > 0 && a < 0);
+  assert(b > 0);
+  return 0;
+}
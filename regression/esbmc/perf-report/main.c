@@ -0,0 +1,11 @@
+int nondet_int();
+
+int main()
+{
+  int x = nondet_int();
+  int sum = 0;
+  for (int i = 0; i < 4; i++)
+    sum += x;
+  __ESBMC_assert(sum == 4 * x, "sum is a multiple of x");
+  return 0;
+}
@@ -0,0 +1,8 @@
+#include <assert.h>
+
+#define LIMIT 10
+
+struct point
+{
+  int x, y;
+};
@@ -0,0 +1,9 @@
+int main()
+{
+  struct point p = {LIMIT, 0};
+  p.y = nondet_int();
+  __ESBMC_assume(p.y >= 0 && p.y < LIMIT);
+  assert(p.x > p.y);
+  assert(p.x + p.y < LIMIT);
+  return 0;
+}
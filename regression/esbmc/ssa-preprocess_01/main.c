@@ -0,0 +1,16 @@
+int nondet_int();
+
+int main()
+{
+  int x = nondet_int();
+  __ESBMC_assume(x > 0 && x < 100);
+  int k = 4;
+  int a = x * k + 1;
+  int b = x * k + 1;
+  for (int i = 0; i < 3; i++)
+    a += k;
+  __ESBMC_assert(a == b + 12, "a and b agree");
+  if (x > 50)
+    __ESBMC_assert(x > 10, "implied by the guard");
+  return 0;
+}
@@ -0,0 +1,13 @@
+int nondet_int();
+
+int main()
+{
+  int x = nondet_int();
+  int k = 3;
+  int a = x * k;
+  int b = x * k;
+  if (x > 5)
+    b = b + 1;
+  __ESBMC_assert(a == b, "differs when x > 5");
+  return 0;
+}
@@ -0,0 +1,10 @@
+#include <assert.h>
+
+int nondet_int();
+
+int main()
+{
+  int x = nondet_int();
+  __ESBMC_assume(x > 10);
+  assert(x < 10);
+}
@@ -0,0 +1,18 @@
+#include <assert.h>
+
+unsigned int nondet_uint();
+
+int main()
+{
+  unsigned int n = nondet_uint();
+  __VERIFIER_assume(n < 4);
+
+  /* The loop is unbounded, but the assumption on n decides every exit
+   * test on its own, without spending the solver budget. */
+  unsigned int sum = 0;
+  for (unsigned int i = 0; i < n; i++)
+    sum += i;
+
+  assert(sum <= 3);
+  return 0;
+}
@@ -0,0 +1,13 @@
+class MyClass:
+    def __init__(self, value: int):
+        self.data:int = value
+
+
+def double(x: int) -> int:
+    return x * 2
+
+
+obj = MyClass(5)
+assert(obj.data == 5)
+y:int = double(obj.data)
+assert(y == 10)
@@ -12,6 +12,7 @@ import xml.etree.ElementTree as ET
 import time
 import shlex
 import subprocess
+import tempfile
 
 if sys.platform.startswith('linux'):
     from resource import *
@@ -37,6 +38,11 @@ if sys.platform.startswith('linux'):
 # FUTURE -> Test that are known to fail due to missing implementation
 # ALL -> Run all tests
 SUPPORTED_TEST_MODES = ["CORE", "FUTURE", "THOROUGH", "KNOWNBUG", "ALL"]
+
+# Separates the runs of a test that runs the tool more than once
+RUN_SEPARATOR = "---"
+# Replaced in the arguments by a temporary directory shared by all runs
+TMPDIR = "$TMPDIR"
 FAIL_MODES = ["KNOWNBUG"]
 
 # Bring up a single benchmark
@@ -65,15 +71,37 @@ class TestCase:
             # Fourth line and beyond
             # Regex of expected output
             self.test_regex = []
+            # A line "---" starts a further run of the tool on the same test
+            # file: the next line holds its arguments, then its regexes follow
+            self.further_runs = []
+            regex = self.test_regex
             for line in fp:
-                self.test_regex.append(line.strip())
+                line = line.strip()
+                if line == RUN_SEPARATOR:
+                    args = fp.readline().strip()
+                    regex = []
+                    self.further_runs.append((args, regex))
+                else:
+                    regex.append(line)
+
 
+    def runs(self):
+        """Lists the arguments and the expected regexes of every run"""
+        return [(self.test_args, self.test_regex)] + self.further_runs
 
-    def generate_run_argument_list(self, *tool):
+    def uses_tmpdir(self):
+        """Whether the runs share a temporary directory"""
+        return any(TMPDIR in args for args, _ in self.runs())
+
+    def generate_run_argument_list(self, *tool, args=None, tmpdir=None):
         """Generates run command list to be used in Popen"""
         result = list(tool)
         result.append(os.path.join(self.test_dir, self.test_file))
-        for x in shlex.split(self.test_args):
+        if args is None:
+            args = self.test_args
+        for x in shlex.split(args):
+            if tmpdir is not None:
+                x = x.replace(TMPDIR, tmpdir)
             if x != "":
                 p = os.path.join(self.test_dir, x)
                 result.append(p if os.path.exists(p) else x)
@@ -105,6 +133,7 @@ class TestCase:
         self.test_args = None
         self.test_file = None
         self.test_mode = "CORE"
+        self.further_runs = []
         self._initialize_test_case()
 
     def save_test(self):
@@ -117,6 +146,11 @@ class TestCase:
             f.write(f"{self.test_args}\n")
             for re in self.test_regex:
                 f.write(f"{re}\n")
+            for args, regex in self.further_runs:
+                f.write(f"{RUN_SEPARATOR}\n")
+                f.write(f"{args}\n")
+                for re in regex:
+                    f.write(f"{re}\n")
 
 
     """Ignore regex and only check for crashes"""
@@ -133,9 +167,10 @@ class Executor:
         self.tool = shlex.split(tool)
         self.timeout = RegressionBase.TIMEOUT
 
-    def run(self, test_case: TestCase):
+    def run(self, test_case: TestCase, args=None, tmpdir=None):
         """Execute the test case with `executable`"""
-        cmd = test_case.generate_run_argument_list(*self.tool)
+        cmd = test_case.generate_run_argument_list(
+            *self.tool, args=args, tmpdir=tmpdir)
 
         try:
             # use subprocess.run because we want to wait for the subprocess to finish
@@ -185,8 +220,8 @@ class RegressionBase(unittest.TestCase):
 def _add_test(test_case, executor):
     """This method returns a function that defines a test"""
 
-    def test(self):
-        stdout, stderr, rc = executor.run(test_case)
+    def check_run(self, args, test_regex, tmpdir):
+        stdout, stderr, rc = executor.run(test_case, args, tmpdir)
 
         if stdout == None:
             timeout_message ="\nTIMEOUT TEST: " + str(test_case.test_dir)
@@ -200,9 +235,10 @@ def _add_test(test_case, executor):
         output_to_validate = stdout.decode() + stderr.decode()
         error_message_prefix = "\nTEST: " + \
             str(test_case.test_dir) + "\nEXPECTED TO FIND: " + \
-            str(test_case.test_regex) + "\n\nPROGRAM OUTPUT\n"
+            str(test_regex) + "\n\nPROGRAM OUTPUT\n"
         error_message = output_to_validate + "\n\nARGUMENTS: " + \
-            str(test_case.generate_run_argument_list(*executor.tool))
+            str(test_case.generate_run_argument_list(
+                *executor.tool, args=args, tmpdir=tmpdir))
 
         if(BENCHMARK_BRINGUP):
             if os.environ.get('LOG_DIR') is None:
@@ -210,12 +246,12 @@ def _add_test(test_case, executor):
             assert os.path.isdir(os.environ['LOG_DIR'])
             destination = os.environ['LOG_DIR'] + '/' + test_case.name
             f=open(destination, 'a')
-            f.write("ESBMC args: " + test_case.test_args + '\n\n')
+            f.write("ESBMC args: " + args + '\n\n')
             f.write(output_to_validate)
             f.close()
 
         matches_regex = True
-        for regex in test_case.test_regex:
+        for regex in test_regex:
             match_regex = re.compile(regex, re.MULTILINE)
             if not match_regex.search(output_to_validate.replace("\r", "")):
                 matches_regex = False
@@ -230,6 +266,17 @@ def _add_test(test_case, executor):
                     self.fail(error_message_prefix + error_message)
             else:
                 self.fail(error_message_prefix + error_message)
+
+    def test(self):
+        if not test_case.uses_tmpdir():
+            for args, test_regex in test_case.runs():
+                check_run(self, args, test_regex, None)
+            return
+
+        # Runs that share state, e.g. a cache, keep it out of the source tree
+        with tempfile.TemporaryDirectory(prefix="esbmc-test-") as tmpdir:
+            for args, test_regex in test_case.runs():
+                check_run(self, args, test_regex, tmpdir)
     return test
 
 
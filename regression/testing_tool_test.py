@@ -147,5 +147,31 @@ class ToolTest2(CTest4):
         self.assertEqual(argument_list, expected, str(argument_list))
 
 
+class CTest5(ParseTest):
+    """Added testcase running the tool twice on a shared directory"""
+
+    def setUp(self):
+        self.test_case: TestCase = TestCase(
+            "./esbmc/goto_cache_01", "goto_cache_01")
+        self.test_parsed: TestCase = TestCase(
+            "./esbmc/goto_cache_01", "goto_cache_01")
+
+    def _read_file_checks(self, test_obj: TestCase):
+        self.assertEqual(test_obj.test_args, "--goto-cache $TMPDIR --unwind 6")
+        self.assertEqual(len(test_obj.runs()), 2)
+        self.assertTrue(test_obj.uses_tmpdir())
+        args, regex = test_obj.runs()[1]
+        self.assertEqual(args, "--goto-cache $TMPDIR --unwind 6")
+        self.assertEqual(regex[1], "^VERIFICATION FAILED$")
+
+    def _argument_list_checks(self, test_obj: TestCase):
+        args, _ = test_obj.runs()[1]
+        argument_list = test_obj.generate_run_argument_list(
+            "__test__", args=args, tmpdir="/tmp/x")
+        expected = ['__test__', './esbmc/goto_cache_01/main.c',
+                    '--goto-cache', '/tmp/x', '--unwind', '6']
+        self.assertEqual(argument_list, expected, str(argument_list))
+
+
 if __name__ == '__main__':
     unittest.main()
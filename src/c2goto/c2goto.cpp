@@ -1,7 +1,7 @@
 #include <fstream>
 #include <memory>
 #include <goto-programs/goto_convert_functions.h>
-#include <goto-programs/write_goto_binary.h>
+#include <goto-programs/goto_binary_index.h>
 #include <langapi/language_ui.h>
 #include <langapi/mode.h>
 #include <util/cmdline.h>
@@ -89,7 +89,9 @@ public:
     std::ofstream out(
       cmdline.getval("output"), std::ios::out | std::ios::binary);
 
-    if (write_goto_binary(out, context, goto_functions))
+    // Written indexed, so that ESBMC only deserialises the library symbols a
+    // program actually uses
+    if (write_goto_binary_index(out, context, goto_functions))
     {
       log_error("Failed to write C library to binary obj");
       return 1;
@@ -5,3 +5,7 @@ class languaget;
 void add_cprover_library(contextt &, const languaget *)
 {
 }
+
+void preload_cprover_library()
+{
+}
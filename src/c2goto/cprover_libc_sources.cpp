@@ -3,6 +3,7 @@
 #include <boost/filesystem/operations.hpp>
 #include <c2goto/cprover_library.h>
 #include <fstream>
+#include <util/config.h>
 #include <util/language.h>
 #include <util/filesystem.h>
 
@@ -43,28 +44,44 @@ static class
 #undef ESBMC_FLAIL
   }
 
-public:
-  const std::string &header_dir()
+  static void write_headers(const std::string &headers)
   {
-    if (headers == "")
-    {
-      using namespace boost::filesystem;
-      headers = base_path() + "/headers";
-      create_directory(headers);
-      create_directory(headers + "/__esbmc");
-      create_directory(headers + "/bits");
-      create_directory(headers + "/sys");
-      create_directory(headers + "/sys/_types");
-      create_directory(headers + "/sys/_pthread");
-      create_directory(headers + "/ubuntu20.04");
-      create_directory(headers + "/ubuntu20.04/kernel_5.15.0-76");
-      create_directory(headers + "/ubuntu20.04/kernel_5.15.0-76/include");
-      create_directory(headers + "/ubuntu20.04/kernel_5.15.0-76/include/linux");
-      create_directory(headers + "/ubuntu20.04/kernel_5.15.0-76/include/asm");
+    using namespace boost::filesystem;
+    create_directory(headers + "/__esbmc");
+    create_directory(headers + "/bits");
+    create_directory(headers + "/sys");
+    create_directory(headers + "/sys/_types");
+    create_directory(headers + "/sys/_pthread");
+    create_directory(headers + "/ubuntu20.04");
+    create_directory(headers + "/ubuntu20.04/kernel_5.15.0-76");
+    create_directory(headers + "/ubuntu20.04/kernel_5.15.0-76/include");
+    create_directory(headers + "/ubuntu20.04/kernel_5.15.0-76/include/linux");
+    create_directory(headers + "/ubuntu20.04/kernel_5.15.0-76/include/asm");
 #define ESBMC_FLAIL(body, size, ...)                                           \
   std::ofstream(headers + "/" #__VA_ARGS__).write(body, size);
 #include <headers/libc_hdr.h>
 #undef ESBMC_FLAIL
+  }
+
+public:
+  const std::string &header_dir()
+  {
+    if (headers == "")
+    {
+      /* Precompiled headers record the paths of the headers they were built
+       * from, so keep ours at a fixed place when they are cached. */
+      const std::string &cache = config.options.get_option("pch-cache");
+      if (!cache.empty())
+        headers = file_operations::persistent_dir(
+          cache,
+          "libc-headers-" + config.options.get_option("pch-cache-build-id"),
+          write_headers);
+      else
+      {
+        headers = base_path() + "/headers";
+        boost::filesystem::create_directory(headers);
+        write_headers(headers);
+      }
     }
     return headers;
   }
@@ -106,6 +123,28 @@ static std::string get_filename_from_path(std::string path)
   return path;
 }
 
+namespace
+{
+/* Clears the "prefix-header" option for the lifetime of the object, restoring
+ * it afterwards even if parsing throws. */
+class prefix_header_disablert
+{
+  std::string prefix_header;
+
+public:
+  prefix_header_disablert()
+    : prefix_header(config.options.get_option("prefix-header"))
+  {
+    config.options.set_option("prefix-header", "");
+  }
+
+  ~prefix_header_disablert()
+  {
+    config.options.set_option("prefix-header", prefix_header);
+  }
+};
+} // namespace
+
 void add_bundled_library_sources(contextt &context, const languaget &c_language)
 {
   /* First extract headers (if not already done) */
@@ -117,6 +156,9 @@ void add_bundled_library_sources(contextt &context, const languaget &c_language)
     skip_fenv = config.ansi_c.cheri != configt::ansi_ct::CHERI_OFF;
 #endif
 
+    /* The prefix header is meant for the user's input files only */
+    prefix_header_disablert no_prefix_header;
+
     /* Next, extract (if not already done) and process every libc/libm file. */
     internal_libc.foreach_libc_libm([&](const std::string &path) {
       if (skip_fenv && get_filename_from_path(path) == "fenv.c")
@@ -3,7 +3,8 @@
 #include <c2goto/cprover_library.h>
 #include <cstdlib>
 #include <fstream>
-#include <goto-programs/read_goto_binary.h>
+#include <memory>
+#include <goto-programs/goto_binary_index.h>
 #include <util/c_link.h>
 #include <util/config.h>
 #include <util/language.h>
@@ -86,80 +87,65 @@ static const struct buffer
   },
 #endif
 };
-} // namespace
 
-static void generate_symbol_deps(
-  irep_idt name,
-  irept irep,
-  std::multimap<irep_idt, irep_idt> &deps)
+/* The internal C library decoded in full by preload_cprover_library(). */
+struct preloaded_libraryt
 {
-  std::pair<irep_idt, irep_idt> type;
-
-  if (irep.id() == "symbol")
-  {
-    type = std::pair<irep_idt, irep_idt>(name, irep.identifier());
-    deps.insert(type);
-    return;
-  }
+  // The library it was decoded from
+  const buffer *clib;
+  goto_binary_indext lib;
+  // Symbol i of `lib`
+  std::vector<symbolt> symbols;
+};
+std::unique_ptr<preloaded_libraryt> preloaded;
+} // namespace
 
-  forall_irep (irep_it, irep.get_sub())
+/* Returns the library for the current configuration, or nullptr if there is
+ * none for it. */
+static const buffer *current_library()
+{
+  switch (config.ansi_c.word_size)
   {
-    if (irep_it->id() == "symbol")
-    {
-      type = std::pair<irep_idt, irep_idt>(name, irep_it->identifier());
-      deps.insert(type);
-      generate_symbol_deps(name, *irep_it, deps);
-    }
-    else if (irep_it->id() == "argument")
-    {
-      type = std::pair<irep_idt, irep_idt>(name, irep_it->cmt_identifier());
-      deps.insert(type);
-    }
-    else
-    {
-      generate_symbol_deps(name, *irep_it, deps);
-    }
+  case 16:
+    log_warning(
+      "this version of ESBMC does not have a C library for 16 bit machines");
+    return nullptr;
+  case 32:
+  case 64:
+    break;
+  default:
+    log_error("No C library for bitwidth {}", config.ansi_c.word_size);
+    abort();
   }
 
-  forall_named_irep (irep_it, irep.get_named_sub())
-  {
-    if (irep_it->second.id() == "symbol")
-    {
-      type = std::pair<irep_idt, irep_idt>(name, irep_it->second.identifier());
-      deps.insert(type);
-    }
-    else if (irep_it->second.id() == "argument")
-    {
-      type =
-        std::pair<irep_idt, irep_idt>(name, irep_it->second.cmt_identifier());
-      deps.insert(type);
-    }
-    else
-    {
-      generate_symbol_deps(name, irep_it->second, deps);
-    }
-  }
+  return &clibs[config.ansi_c.cheri][!config.ansi_c.use_fixed_for_float]
+               [config.ansi_c.word_size == 64];
 }
 
-static void ingest_symbol(
-  irep_idt name,
-  std::multimap<irep_idt, irep_idt> &deps,
-  std::list<irep_idt> &to_include)
+void preload_cprover_library()
 {
-  std::pair<
-    std::multimap<irep_idt, irep_idt>::const_iterator,
-    std::multimap<irep_idt, irep_idt>::const_iterator>
-    range;
-  std::multimap<irep_idt, irep_idt>::const_iterator it;
+  if (config.ansi_c.lib == configt::ansi_ct::libt::LIB_NONE)
+    return;
 
-  range = deps.equal_range(name);
-  if (range.first == range.second)
+  const buffer *clib = current_library();
+  /* Without a compiled library, the sources are parsed with the options of
+   * each run, so there is nothing to share. */
+  if (!clib || clib->size == 0 || (preloaded && preloaded->clib == clib))
     return;
 
-  for (it = range.first; it != range.second; it++)
-    to_include.push_back(it->second);
+  auto lib = std::make_unique<preloaded_libraryt>();
+  lib->clib = clib;
+  if (lib->lib.open(clib->start, clib->size))
+  {
+    log_error("Malformed internal C library");
+    abort();
+  }
+
+  lib->symbols.resize(lib->lib.symbol_count());
+  for (unsigned i = 0; i < lib->lib.symbol_count(); i++)
+    lib->lib.read_symbol(i, lib->symbols[i]);
 
-  deps.erase(name);
+  preloaded = std::move(lib);
 }
 
 void add_cprover_library(contextt &context, const languaget *c_language)
@@ -167,28 +153,9 @@ void add_cprover_library(contextt &context, const languaget *c_language)
   if (config.ansi_c.lib == configt::ansi_ct::libt::LIB_NONE)
     return;
 
-  contextt new_ctx, store_ctx;
-  goto_functionst goto_functions;
-  std::multimap<irep_idt, irep_idt> symbol_deps;
-  std::list<irep_idt> to_include;
-  const buffer *clib;
-
-  switch (config.ansi_c.word_size)
-  {
-  case 16:
-    log_warning(
-      "this version of ESBMC does not have a C library for 16 bit machines");
+  const buffer *clib = current_library();
+  if (!clib)
     return;
-  case 32:
-  case 64:
-    break;
-  default:
-    log_error("No C library for bitwidth {}", config.ansi_c.word_size);
-    abort();
-  }
-
-  clib = &clibs[config.ansi_c.cheri][!config.ansi_c.use_fixed_for_float]
-               [config.ansi_c.word_size == 64];
 
   if (clib->size == 0)
   {
@@ -198,53 +165,74 @@ void add_cprover_library(contextt &context, const languaget *c_language)
     abort();
   }
 
-  if (read_goto_binary_array(clib->start, clib->size, new_ctx, goto_functions))
+  // Decode the records of the library unless they already are
+  contextt store_ctx;
+  goto_binary_indext fresh;
+  bool use_preloaded = preloaded && preloaded->clib == clib;
+  goto_binary_indext &lib = use_preloaded ? preloaded->lib : fresh;
+  if (!use_preloaded && lib.open(clib->start, clib->size))
+  {
+    log_error("Malformed internal C library");
     abort();
+  }
 
-  new_ctx.foreach_operand([&symbol_deps](const symbolt &s) {
-    generate_symbol_deps(s.id, s.value, symbol_deps);
-    generate_symbol_deps(s.id, s.type, symbol_deps);
-  });
-
-  // Add two hacks; we might use either pthread_mutex_lock or the checked
-  // variant; so if one version is used, pull in the other too.
-  std::pair<irep_idt, irep_idt> lockcheck(
-    dstring("pthread_mutex_lock"), dstring("pthread_mutex_lock_check"));
-  symbol_deps.insert(lockcheck);
+  /* The index lists, for every library symbol, the library symbols it refers
+   * to. Start from the symbols the program declares but doesn't define and
+   * pull in everything they depend on; only those get deserialised. */
+  std::vector<bool> included(lib.symbol_count(), false);
+  std::vector<unsigned> to_include;
+  auto include = [&included, &to_include](unsigned i) {
+    if (!included[i])
+    {
+      included[i] = true;
+      to_include.push_back(i);
+    }
+  };
 
-  std::pair<irep_idt, irep_idt> condcheck(
-    dstring("pthread_cond_wait"), dstring("pthread_cond_wait_check"));
-  symbol_deps.insert(condcheck);
+  std::unordered_map<irep_idt, unsigned, irep_id_hash> lib_symbols;
+  for (unsigned i = 0; i < lib.symbol_count(); i++)
+  {
+    const irep_idt &id = lib.symbol_name(i);
+    lib_symbols.emplace(id, i);
+    const symbolt *symbol = context.find_symbol(id);
+    if (symbol != nullptr && symbol->value.is_nil())
+      include(i);
+  }
 
-  std::pair<irep_idt, irep_idt> joincheck(
-    dstring("pthread_join"), dstring("pthread_join_noswitch"));
-  symbol_deps.insert(joincheck);
+  // Add three hacks; we might use either pthread_mutex_lock or the checked
+  // variant; so if one version is used, pull in the other too.
+  const std::pair<const char *, const char *> hacks[] = {
+    {"pthread_mutex_lock", "pthread_mutex_lock_check"},
+    {"pthread_cond_wait", "pthread_cond_wait_check"},
+    {"pthread_join", "pthread_join_noswitch"}};
 
-  /* The code just pulled into store_ctx might use other symbols in the C
-   * library. So, repeatedly search for new C library symbols that we use but
-   * haven't pulled in, then pull them in. We finish when we've made a pass
-   * that adds no new symbols. */
+  for (size_t n = 0; n < to_include.size(); n++)
+  {
+    unsigned i = to_include[n];
+    for (unsigned dep : lib.symbol_deps(i))
+      include(dep);
 
-  new_ctx.foreach_operand(
-    [&context, &store_ctx, &symbol_deps, &to_include](const symbolt &s) {
-      const symbolt *symbol = context.find_symbol(s.id);
-      if (symbol != nullptr && symbol->value.is_nil())
-      {
-        store_ctx.add(s);
-        ingest_symbol(s.id, symbol_deps, to_include);
-      }
-    });
+    for (const auto &[from, to] : hacks)
+    {
+      if (lib.symbol_name(i) != from)
+        continue;
+      auto it = lib_symbols.find(to);
+      if (it != lib_symbols.end())
+        include(it->second);
+    }
+  }
 
-  for (std::list<irep_idt>::const_iterator nameit = to_include.begin();
-       nameit != to_include.end();
-       nameit++)
+  for (unsigned i : to_include)
   {
-    symbolt *s = new_ctx.find_symbol(*nameit);
-    if (s != nullptr)
+    if (use_preloaded)
     {
-      store_ctx.add(*s);
-      ingest_symbol(*nameit, symbol_deps, to_include);
+      store_ctx.add(preloaded->symbols[i]);
+      continue;
     }
+
+    symbolt s;
+    lib.read_symbol(i, s);
+    store_ctx.add(s);
   }
 
   if (c_link(context, store_ctx, "<built-in-library>"))
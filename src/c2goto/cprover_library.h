@@ -23,4 +23,9 @@ void add_cprover_library(
   contextt &context,
   const languaget *c_language = nullptr);
 
+/* Decodes the whole compiled internal libc for the current configuration and
+ * keeps it in memory. add_cprover_library() then only copies the symbols it
+ * needs, in this process and in any process forked from it afterwards. */
+void preload_cprover_library();
+
 #endif
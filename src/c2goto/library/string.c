@@ -255,7 +255,7 @@ __ESBMC_HIDE:;
   return cpy;
 }
 
-void *memcpy(void *dst, const void *src, size_t n)
+void *__memcpy_impl(void *dst, const void *src, size_t n)
 {
 __ESBMC_HIDE:;
   char *cdst = dst;
@@ -265,6 +265,14 @@ __ESBMC_HIDE:;
   return dst;
 }
 
+void *memcpy(void *dst, const void *src, size_t n)
+{
+__ESBMC_HIDE:;
+  void *hax = &__memcpy_impl;
+  (void)hax;
+  return __ESBMC_memcpy(dst, src, n);
+}
+
 void *__memset_impl(void *s, int c, size_t n)
 {
 __ESBMC_HIDE:;
@@ -282,7 +290,7 @@ __ESBMC_HIDE:;
   return __ESBMC_memset(s, c, n);
 }
 
-void *memmove(void *dest, const void *src, size_t n)
+void *__memmove_impl(void *dest, const void *src, size_t n)
 {
 __ESBMC_HIDE:;
   char *cdest = dest;
@@ -300,7 +308,15 @@ __ESBMC_HIDE:;
   return dest;
 }
 
-int memcmp(const void *s1, const void *s2, size_t n)
+void *memmove(void *dest, const void *src, size_t n)
+{
+__ESBMC_HIDE:;
+  void *hax = &__memmove_impl;
+  (void)hax;
+  return __ESBMC_memmove(dest, src, n);
+}
+
+int __memcmp_impl(const void *s1, const void *s2, size_t n)
 {
 __ESBMC_HIDE:;
   int res = 0;
@@ -314,6 +330,14 @@ __ESBMC_HIDE:;
   return res;
 }
 
+int memcmp(const void *s1, const void *s2, size_t n)
+{
+__ESBMC_HIDE:;
+  void *hax = &__memcmp_impl;
+  (void)hax;
+  return __ESBMC_memcmp(s1, s2, n);
+}
+
 void *memchr(const void *buf, int ch, size_t n)
 {
   while (n && (*(unsigned char *)buf != (unsigned char)ch))
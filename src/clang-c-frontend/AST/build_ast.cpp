@@ -11,6 +11,7 @@ CC_DIAGNOSTIC_IGNORE_LLVM_CHECKS()
 #include <clang/Frontend/CompilerInvocation.h>
 #include <clang/Frontend/FrontendActions.h>
 #include <clang/Frontend/TextDiagnosticPrinter.h>
+#include <clang/Frontend/Utils.h>
 #include <clang/Lex/PreprocessorOptions.h>
 #include <clang/Tooling/Tooling.h>
 #include <llvm/Option/ArgList.h>
@@ -48,31 +49,12 @@ static clang::driver::Driver *newDriver(
   return CompilerDriver;
 }
 
-std::unique_ptr<clang::ASTUnit> buildASTs(
-  const std::string &intrinsics,
-  const std::vector<std::string> &compiler_args)
+static llvm::IntrusiveRefCntPtr<clang::DiagnosticOptions>
+newDiagnosticOptions(const std::vector<const char *> &Argv)
 {
-  // Create virtual file system to add clang's headers
-  llvm::IntrusiveRefCntPtr<llvm::vfs::OverlayFileSystem> OverlayFileSystem(
-    new llvm::vfs::OverlayFileSystem(llvm::vfs::getRealFileSystem()));
-
-  llvm::IntrusiveRefCntPtr<llvm::vfs::InMemoryFileSystem> InMemoryFileSystem(
-    new llvm::vfs::InMemoryFileSystem);
-  OverlayFileSystem->pushOverlay(InMemoryFileSystem);
-
-  llvm::IntrusiveRefCntPtr<clang::FileManager> Files(
-    new clang::FileManager(clang::FileSystemOptions(), OverlayFileSystem));
-
-  // Create everything needed to create a CompilerInvocation,
-  // copied from ToolInvocation::run
   llvm::IntrusiveRefCntPtr<clang::DiagnosticOptions> DiagOpts =
     new clang::DiagnosticOptions();
 
-  std::vector<const char *> Argv;
-  for (const std::string &Str : compiler_args)
-    Argv.push_back(Str.c_str());
-  const char *const BinaryName = Argv[0];
-
   unsigned MissingArgIndex, MissingArgCount;
   llvm::opt::InputArgList ParsedArgs =
     clang::driver::getDriverOptTable().ParseArgs(
@@ -81,17 +63,20 @@ std::unique_ptr<clang::ASTUnit> buildASTs(
       MissingArgCount);
 
   clang::ParseDiagnosticArgs(*DiagOpts, ParsedArgs);
+  return DiagOpts;
+}
 
-  clang::TextDiagnosticPrinter DiagnosticPrinter(llvm::errs(), &*DiagOpts);
-
-  clang::DiagnosticsEngine *Diagnostics = new clang::DiagnosticsEngine(
-    llvm::IntrusiveRefCntPtr<clang::DiagnosticIDs>(new clang::DiagnosticIDs()),
-    &*DiagOpts,
-    &DiagnosticPrinter,
-    false);
+/// Runs the driver on \p Argv to get the cc1 invocation for its only job,
+/// copied from ToolInvocation::run
+static std::shared_ptr<clang::CompilerInvocation> newCompilerInvocation(
+  clang::DiagnosticsEngine *Diagnostics,
+  const std::vector<const char *> &Argv,
+  llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem> VFS)
+{
+  const char *const BinaryName = Argv[0];
 
   const std::unique_ptr<clang::driver::Driver> Driver(
-    newDriver(Diagnostics, BinaryName, &Files->getVirtualFileSystem()));
+    newDriver(Diagnostics, BinaryName, std::move(VFS)));
 
   // Since the input might only be virtual, don't check whether it exists.
   Driver->setCheckInputsExist(false);
@@ -114,6 +99,43 @@ std::unique_ptr<clang::ASTUnit> buildASTs(
     llvm::errs() << "\n";
   }
 
+  return Invocation;
+}
+
+std::unique_ptr<clang::ASTUnit> buildASTs(
+  const std::string &intrinsics,
+  const std::vector<std::string> &compiler_args)
+{
+  // Create virtual file system to add clang's headers
+  llvm::IntrusiveRefCntPtr<llvm::vfs::OverlayFileSystem> OverlayFileSystem(
+    new llvm::vfs::OverlayFileSystem(llvm::vfs::getRealFileSystem()));
+
+  llvm::IntrusiveRefCntPtr<llvm::vfs::InMemoryFileSystem> InMemoryFileSystem(
+    new llvm::vfs::InMemoryFileSystem);
+  OverlayFileSystem->pushOverlay(InMemoryFileSystem);
+
+  llvm::IntrusiveRefCntPtr<clang::FileManager> Files(
+    new clang::FileManager(clang::FileSystemOptions(), OverlayFileSystem));
+
+  // Create everything needed to create a CompilerInvocation
+  std::vector<const char *> Argv;
+  for (const std::string &Str : compiler_args)
+    Argv.push_back(Str.c_str());
+
+  llvm::IntrusiveRefCntPtr<clang::DiagnosticOptions> DiagOpts =
+    newDiagnosticOptions(Argv);
+
+  clang::TextDiagnosticPrinter DiagnosticPrinter(llvm::errs(), &*DiagOpts);
+
+  clang::DiagnosticsEngine *Diagnostics = new clang::DiagnosticsEngine(
+    llvm::IntrusiveRefCntPtr<clang::DiagnosticIDs>(new clang::DiagnosticIDs()),
+    &*DiagOpts,
+    &DiagnosticPrinter,
+    false);
+
+  std::shared_ptr<clang::CompilerInvocation> Invocation = newCompilerInvocation(
+    Diagnostics, Argv, &Files->getVirtualFileSystem());
+
   // Create our custom action
   auto action = new esbmc_action(std::move(intrinsics));
 
@@ -132,3 +154,61 @@ std::unique_ptr<clang::ASTUnit> buildASTs(
 
   return unit;
 }
+
+namespace
+{
+/// Collects every file the header depends on, including system headers,
+/// since ESBMC's own headers are included as such.
+class all_dependencies_collector : public clang::DependencyCollector
+{
+public:
+  bool needSystemDependencies() override
+  {
+    return true;
+  }
+};
+} // namespace
+
+bool buildPCH(
+  const std::string &intrinsics,
+  const std::vector<std::string> &compiler_args,
+  const std::string &output,
+  std::vector<std::string> &dependencies)
+{
+  std::vector<const char *> Argv;
+  for (const std::string &Str : compiler_args)
+    Argv.push_back(Str.c_str());
+
+  llvm::IntrusiveRefCntPtr<clang::DiagnosticOptions> DiagOpts =
+    newDiagnosticOptions(Argv);
+
+  clang::TextDiagnosticPrinter DiagnosticPrinter(llvm::errs(), &*DiagOpts);
+
+  llvm::IntrusiveRefCntPtr<clang::DiagnosticsEngine> Diagnostics(
+    new clang::DiagnosticsEngine(
+      llvm::IntrusiveRefCntPtr<clang::DiagnosticIDs>(
+        new clang::DiagnosticIDs()),
+      &*DiagOpts,
+      &DiagnosticPrinter,
+      false));
+
+  std::shared_ptr<clang::CompilerInvocation> Invocation = newCompilerInvocation(
+    Diagnostics.get(), Argv, llvm::vfs::getRealFileSystem());
+
+  Invocation->getFrontendOpts().ProgramAction = clang::frontend::GeneratePCH;
+  Invocation->getFrontendOpts().OutputFile = output;
+
+  clang::CompilerInstance CI(std::make_shared<clang::PCHContainerOperations>());
+  CI.setInvocation(std::move(Invocation));
+  CI.setDiagnostics(Diagnostics.get());
+
+  auto collector = std::make_shared<all_dependencies_collector>();
+  CI.addDependencyCollector(collector);
+
+  esbmc_pch_action action(intrinsics);
+  if (!CI.ExecuteAction(action) || Diagnostics->hasErrorOccurred())
+    return true;
+
+  dependencies = collector->getDependencies().vec();
+  return false;
+}
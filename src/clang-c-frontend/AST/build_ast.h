@@ -18,4 +18,13 @@ std::unique_ptr<clang::ASTUnit> buildASTs(
   const std::string &intrinsics,
   const std::vector<std::string> &compiler_args);
 
+/// Precompiles the header given as input in \p compiler_args into \p output
+/// and collects the paths of all files it includes in \p dependencies.
+/// Returns true on error.
+bool buildPCH(
+  const std::string &intrinsics,
+  const std::vector<std::string> &compiler_args,
+  const std::string &output,
+  std::vector<std::string> &dependencies);
+
 #endif /* CLANG_C_FRONTEND_AST_BUILD_AST_H_ */
@@ -41,4 +41,26 @@ public:
   std::string intrinsics;
 };
 
+/// Precompiles a header, with ESBMC's intrinsics in the predefines just as
+/// esbmc_action has them, so that translation units using the result need
+/// not declare them again.
+class esbmc_pch_action : public clang::GeneratePCHAction
+{
+public:
+  explicit esbmc_pch_action(const std::string &esbmc_instrinsics)
+    : intrinsics(esbmc_instrinsics)
+  {
+  }
+
+  bool BeginSourceFileAction(clang::CompilerInstance &CI) override
+  {
+    clang::Preprocessor &PP = CI.getPreprocessor();
+    PP.setPredefines(PP.getPredefines() + intrinsics);
+
+    return clang::GeneratePCHAction::BeginSourceFileAction(CI);
+  }
+
+  std::string intrinsics;
+};
+
 #endif /* CLANG_C_FRONTEND_AST_ESBMC_ACTION_H_ */
@@ -13,8 +13,12 @@ CC_DIAGNOSTIC_POP()
 #include <clang-c-frontend/clang_c_language.h>
 #include <clang-c-frontend/clang_c_main.h>
 #include <util/c_expr2string.h>
+#include <fstream>
+#include <map>
+#include <mutex>
 #include <sstream>
 #include <util/c_link.h>
+#include <util/crypto_hash.h>
 
 #include <util/filesystem.h>
 
@@ -285,11 +289,30 @@ bool clang_c_languaget::parse(const std::string &path)
 
   // Get compiler arguments and add the file path
   std::vector<std::string> new_compiler_args(compiler_args);
-  new_compiler_args.push_back(path);
 
   // Get intrinsics
   std::string intrinsics = internal_additions();
 
+  const std::string prefix_header = config.options.get_option("prefix-header");
+  if (!prefix_header.empty())
+  {
+    // The precompiled header already declares the intrinsics
+    std::string pch = prefix_pch(prefix_header, intrinsics);
+    if (!pch.empty())
+    {
+      new_compiler_args.emplace_back("-include-pch");
+      new_compiler_args.push_back(pch);
+      intrinsics.clear();
+    }
+    else
+    {
+      new_compiler_args.emplace_back("-include");
+      new_compiler_args.push_back(prefix_header);
+    }
+  }
+
+  new_compiler_args.push_back(path);
+
   // Generate ASTUnit and add to our vector
   auto AST = buildASTs(intrinsics, new_compiler_args);
 
@@ -303,6 +326,107 @@ bool clang_c_languaget::parse(const std::string &path)
   return false;
 }
 
+/* A precompiled header is only valid as long as none of the files it was
+ * built from changed. Next to it, we keep the size, modification time and
+ * path of each of them, one per line. */
+static bool pch_up_to_date(const std::string &pch, const std::string &deps)
+{
+  using namespace boost::filesystem;
+  std::ifstream in(deps);
+  if (!in || !exists(pch))
+    return false;
+
+  std::uintmax_t size;
+  std::time_t mtime;
+  std::string file;
+  while (in >> size >> mtime && std::getline(in >> std::ws, file))
+  {
+    boost::system::error_code ec;
+    if (file_size(file, ec) != size || ec || last_write_time(file, ec) != mtime)
+      return false;
+  }
+
+  return in.eof();
+}
+
+std::string clang_c_languaget::prefix_pch(
+  const std::string &header,
+  const std::string &intrinsics) const
+{
+  const std::string cache = config.options.get_option("pch-cache");
+  if (cache.empty())
+    return "";
+
+  // The header has to be precompiled with exactly the arguments used for the
+  // inputs, but only once per run, even when parsing them concurrently.
+  static std::mutex mutex;
+  static std::map<std::vector<std::string>, std::string> built;
+  std::lock_guard<std::mutex> lock(mutex);
+
+  // force_file_type() ends the arguments with the language of the inputs
+  std::vector<std::string> args(compiler_args);
+  args.emplace_back("-x");
+  args.push_back(compiler_args.back() + "-header");
+  args.push_back(boost::filesystem::absolute(header).string());
+
+  auto it = built.find(args);
+  if (it != built.end())
+    return it->second;
+
+  crypto_hash h;
+  std::string build_id = config.options.get_option("pch-cache-build-id");
+  h.ingest(build_id.c_str(), build_id.size() + 1);
+  for (const std::string &arg : args)
+    h.ingest(arg.c_str(), arg.size() + 1);
+  h.ingest(intrinsics.c_str(), intrinsics.size());
+  h.fin();
+
+  std::string base = (boost::filesystem::path(cache) / h.to_string()).string();
+  std::string pch = base + ".pch", deps = base + ".deps";
+  if (pch_up_to_date(pch, deps))
+  {
+    log_status("Using precompiled {}", header);
+    return built[args] = pch;
+  }
+
+  log_status("Precompiling {}", header);
+  boost::filesystem::create_directories(cache);
+  std::string tmp =
+    base + boost::filesystem::unique_path(".%%%%-%%%%.tmp").string();
+  std::vector<std::string> files;
+  if (buildPCH(intrinsics, args, tmp, files))
+  {
+    boost::system::error_code ec;
+    boost::filesystem::remove(tmp, ec);
+    log_warning("Failed to precompile {}, including it instead", header);
+    return built[args] = "";
+  }
+
+  boost::system::error_code ec;
+  {
+    std::ofstream out(tmp + ".deps");
+    for (const std::string &file : files)
+      out << boost::filesystem::file_size(file, ec) << ' '
+          << boost::filesystem::last_write_time(file, ec) << ' ' << file
+          << '\n';
+  }
+
+  // Other processes sharing the cache may replace the same entry concurrently,
+  // with an equivalent one.
+  boost::filesystem::rename(tmp, pch, ec);
+  if (!ec)
+    boost::filesystem::rename(tmp + ".deps", deps, ec);
+  if (ec)
+  {
+    boost::filesystem::remove(tmp, ec);
+    boost::filesystem::remove(tmp + ".deps", ec);
+    log_warning("Failed to cache precompiled {}, including it instead", header);
+    return built[args] = "";
+  }
+
+  return built[args] = pch;
+}
+
 bool clang_c_languaget::typecheck(contextt &context, const std::string &module)
 {
   contextt new_context;
@@ -380,6 +504,9 @@ _Bool __ESBMC_is_little_endian();
 int __ESBMC_rounding_mode = 0;
 
 void *__ESBMC_memset(void *, int, unsigned int);
+void *__ESBMC_memcpy(void *, const void *, __SIZE_TYPE__);
+void *__ESBMC_memmove(void *, const void *, __SIZE_TYPE__);
+int __ESBMC_memcmp(const void *, const void *, __SIZE_TYPE__);
 
 /* same semantics as memcpy(tgt, src, size) where size matches the size of the
  * types tgt and src point to. */
@@ -19,6 +19,11 @@ public:
 
   bool parse(const std::string &path) override;
 
+  bool thread_safe_parse() const override
+  {
+    return true;
+  }
+
   bool final(contextt &context) override;
 
   bool typecheck(contextt &context, const std::string &module) override;
@@ -62,6 +67,11 @@ protected:
   static const std::string &clang_headers_path();
   void build_compiler_args(const std::string &tmp_dir);
 
+  /// Path of the precompiled \p header in the --pch-cache directory, built
+  /// if missing or out of date; empty when it can't be used.
+  std::string
+  prefix_pch(const std::string &header, const std::string &intrinsics) const;
+
   std::vector<std::string> compiler_args;
   std::vector<std::unique_ptr<clang::ASTUnit>> ASTs;
 };
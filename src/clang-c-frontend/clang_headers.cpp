@@ -1,6 +1,7 @@
 #include <clang-c-frontend/clang_c_language.h>
 #include <fstream>
 #include <ac_config.h>
+#include <util/config.h>
 #include <util/filesystem.h>
 
 #ifdef ESBMC_CLANG_HEADERS_BUNDLED
@@ -14,6 +15,25 @@ extern "C"
 const std::string &clang_c_languaget::clang_headers_path()
 {
 #ifdef ESBMC_CLANG_HEADERS_BUNDLED
+  auto write_headers = [](const std::string &dir) {
+#define ESBMC_FLAIL(body, size, ...)                                           \
+  std::ofstream(dir + "/" #__VA_ARGS__).write(body, size);
+#include <headers/cheaders.h>
+#undef ESBMC_FLAIL
+  };
+
+  /* Precompiled headers record the paths of the headers they were built from,
+   * so keep ours at a fixed place when they are cached. */
+  const std::string &cache = config.options.get_option("pch-cache");
+  if (!cache.empty())
+  {
+    static const std::string path = file_operations::persistent_dir(
+      cache,
+      "clang-headers-" + config.options.get_option("pch-cache-build-id"),
+      write_headers);
+    return path;
+  }
+
   // Dump clang headers into a temporary directory
   static bool dumped = false;
   /* About the path being static:
@@ -25,10 +45,7 @@ const std::string &clang_c_languaget::clang_headers_path()
   if (!dumped)
   {
     dumped = true;
-#define ESBMC_FLAIL(body, size, ...)                                           \
-  std::ofstream(p.path() + "/" #__VA_ARGS__).write(body, size);
-#include <headers/cheaders.h>
-#undef ESBMC_FLAIL
+    write_headers(p.path());
   }
   return p.path();
 #else
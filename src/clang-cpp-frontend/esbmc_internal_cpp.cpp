@@ -1,4 +1,5 @@
 #include <clang-cpp-frontend/esbmc_internal_cpp.h>
+#include <util/config.h>
 #include <util/filesystem.h>
 extern "C"
 {
@@ -6,24 +7,36 @@ extern "C"
 #undef ESBMC_FLAIL
 }
 
-const std::string &esbmct::abstract_cpp_includes()
+static void write_cpp_includes(const std::string &dir)
 {
-  // Dump CPP headers into a temporary directory
-  static bool dumped = false;
-  /* About the path being static:
-   * The static member 'dumped' above is used to check whether the headers were
-   * ever extracted before. This guarantees that the same path is used
-   * during a run. And no more than one is required anyway */
-  static auto p =
-    file_operations::create_tmp_dir("esbmc-cpp-headers-%%%%-%%%%-%%%%");
-  if (!dumped)
-  {
-    dumped = true;
 #define ESBMC_FLAIL(body, size, ...)                                           \
-  file_operations::create_path_and_write(                                      \
-    p.path() + "/" #__VA_ARGS__, body, size);
+  file_operations::create_path_and_write(dir + "/" #__VA_ARGS__, body, size);
 #include <abstract_includes/cpp_includes.h> /* generated by build system */
 #undef ESBMC_FLAIL
+}
+
+const std::string &esbmct::abstract_cpp_includes()
+{
+  /* Precompiled headers record the paths of the headers they were built from,
+   * so keep ours at a fixed place when they are cached. */
+  const std::string cache = config.options.get_option("pch-cache");
+  if (!cache.empty())
+  {
+    static const std::string path = file_operations::persistent_dir(
+      cache,
+      "cpp-headers-" + config.options.get_option("pch-cache-build-id"),
+      write_cpp_includes);
+    return path;
   }
+
+  /* Dump CPP headers into a temporary directory, once per run. The
+   * initialization of the static is thread-safe, which matters as this is
+   * called while parsing input files concurrently. */
+  static const file_operations::tmp_path p = [] {
+    file_operations::tmp_path p =
+      file_operations::create_tmp_dir("esbmc-cpp-headers-%%%%-%%%%-%%%%");
+    write_cpp_includes(p.path());
+    return p;
+  }();
   return p.path();
-}
\ No newline at end of file
+}
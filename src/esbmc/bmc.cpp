@@ -1,3 +1,4 @@
+#include <cerrno>
 #include <csignal>
 #include <memory>
 #include <sys/types.h>
@@ -8,6 +9,7 @@
 #ifndef _WIN32
 #include <unistd.h>
 #include <sched.h>
+#include <sys/wait.h>
 #else
 #include <windows.h>
 #include <winbase.h>
@@ -25,6 +27,7 @@
 #include <goto-symex/goto_trace.h>
 #include <goto-symex/reachability_tree.h>
 #include <goto-symex/slice.h>
+#include <goto-symex/ssa_preprocess.h>
 #include <goto-symex/xml_goto_trace.h>
 #include <langapi/language_util.h>
 #include <langapi/languages.h>
@@ -35,12 +38,21 @@
 #include <util/location.h>
 
 #include <util/migrate.h>
+#include <util/perf_report.h>
 #include <util/show_symbol_table.h>
 #include <util/time_stopping.h>
 #include <util/cache.h>
 #include <atomic>
 #include <goto-symex/witnesses.h>
 
+static perf_countert smt_asts("smt-asts");
+static perf_countert smt_cache_entries("smt-cache-entries");
+static perf_countert ssa_steps("ssa-steps");
+static perf_countert ssa_steps_remaining("ssa-steps-remaining");
+static perf_countert vccs("vccs");
+static perf_countert vccs_remaining("vccs-remaining");
+static perf_countert components_count("components");
+
 bmct::bmct(goto_functionst &funcs, optionst &opts, contextt &_context)
   : options(opts), context(_context), ns(context)
 {
@@ -54,6 +66,11 @@ bmct::bmct(goto_functionst &funcs, optionst &opts, contextt &_context)
     else
       algorithms.emplace_back(std::make_unique<symex_slicet>(options));
 
+    if (
+      options.get_bool_option("ssa-preprocess") &&
+      !options.get_bool_option("smt-during-symex"))
+      algorithms.emplace_back(std::make_unique<ssa_preprocesst>());
+
     // Run cache if user has specified the option
     if (options.get_bool_option("cache-asserts"))
       // Store the set between runs
@@ -155,10 +172,16 @@ void bmct::generate_smt_from_equation(
   log_status("Encoding remaining VCC(s) using {}", logic);
 
   fine_timet encode_start = current_time();
-  eq.convert(smt_conv);
+  {
+    perf_phaset phase("convert");
+    eq.convert(smt_conv);
+  }
   fine_timet encode_stop = current_time();
   log_status(
     "Encoding to solver time: {}s", time2string(encode_stop - encode_start));
+
+  smt_asts.add(smt_conv.live_asts.size());
+  smt_cache_entries.add(smt_conv.smt_cache.size());
 }
 
 smt_convt::resultt
@@ -178,7 +201,11 @@ bmct::run_decision_procedure(smt_convt &smt_conv, symex_target_equationt &eq)
   log_progress("Solving with solver {}", smt_conv.solver_text());
 
   fine_timet sat_start = current_time();
-  smt_convt::resultt dec_result = smt_conv.dec_solve();
+  smt_convt::resultt dec_result;
+  {
+    perf_phaset phase("solve");
+    dec_result = smt_conv.dec_solve();
+  }
   fine_timet sat_stop = current_time();
 
   // output runtime
@@ -595,6 +622,12 @@ smt_convt::resultt bmct::run_thread(std::shared_ptr<symex_target_equationt> &eq)
       ignored += a->ignored();
     }
 
+    ssa_steps.add(eq->SSA_steps.size());
+    ssa_steps_remaining.add(
+      (BigInt(eq->SSA_steps.size()) - ignored).to_uint64());
+    vccs.add(result.total_claims);
+    vccs_remaining.add(result.remaining_claims);
+
     if (
       options.get_bool_option("program-only") ||
       options.get_bool_option("program-too"))
@@ -647,6 +680,13 @@ smt_convt::resultt bmct::run_thread(std::shared_ptr<symex_target_equationt> &eq)
       options.get_bool_option("base-case"))
       return multi_property_check(*eq, result.remaining_claims);
 
+    if (
+      options.get_bool_option("parallel-components") &&
+      !options.get_bool_option("smt-during-symex") &&
+      !options.get_bool_option("smt-formula-too") &&
+      !options.get_bool_option("smt-formula-only"))
+      return parallel_components_check(*eq);
+
     return run_decision_procedure(*runtime_solver, *eq);
   }
 
@@ -774,7 +814,11 @@ smt_convt::resultt bmct::multi_property_check(
       runtime_solver->solver_text());
 
     fine_timet sat_start = current_time();
-    smt_convt::resultt result = runtime_solver->dec_solve();
+    smt_convt::resultt result;
+    {
+      perf_phaset phase("solve");
+      result = runtime_solver->dec_solve();
+    }
     fine_timet sat_stop = current_time();
     log_status(
       "Runtime decision procedure: {}s", time2string(sat_stop - sat_start));
@@ -855,3 +899,143 @@ smt_convt::resultt bmct::multi_property_check(
 
   return final_result;
 }
+
+smt_convt::resultt bmct::solve_component(
+  const symex_target_equationt &eq,
+  const std::vector<size_t> &components,
+  size_t component)
+{
+  symex_target_equationt local_eq = eq;
+  component_slicer slicer(components, component);
+  slicer.run(local_eq.SSA_steps);
+
+  std::unique_ptr<smt_convt> solver(create_solver("", ns, options));
+  generate_smt_from_equation(*solver, local_eq);
+
+  perf_phaset phase("solve");
+  return solver->dec_solve();
+}
+
+#ifndef _WIN32
+/* Base of the exit statuses of the processes solving components */
+static const int component_exit_base = 100;
+#endif
+
+/* Solves the independent components of the formula separately, each in a
+ * forked process with its own solver, since the irep and SMT layers keep
+ * global state that is not thread-safe. The formula is satisfiable iff one
+ * of the components is; that component is then solved again here so the
+ * counterexample can be built from its model. */
+smt_convt::resultt bmct::parallel_components_check(symex_target_equationt &eq)
+{
+  std::vector<size_t> components;
+  size_t num_components =
+    component_slicer::partition(eq.SSA_steps, components);
+  components_count.add(num_components);
+
+  if (num_components <= 1)
+    return run_decision_procedure(*runtime_solver, eq);
+
+  log_status("Solving {} independent components", num_components);
+
+  size_t failed = SIZE_MAX;
+  bool error = false;
+  size_t next = 0;
+
+  // Solves the remaining components in this process
+  auto solve_in_sequence = [&]() {
+    for (; next < num_components && failed == SIZE_MAX; next++)
+    {
+      smt_convt::resultt res = solve_component(eq, components, next);
+      if (res == smt_convt::P_SATISFIABLE)
+        failed = next;
+      else if (res != smt_convt::P_UNSATISFIABLE)
+        error = true;
+    }
+  };
+
+#ifdef _WIN32
+  solve_in_sequence();
+#else
+  const size_t max_jobs = std::max(1u, std::thread::hardware_concurrency());
+  std::map<pid_t, size_t> running;
+  bool fork_failed = false;
+
+  for (;;)
+  {
+    while (
+      !fork_failed && failed == SIZE_MAX && next < num_components &&
+      running.size() < max_jobs)
+    {
+      pid_t pid = fork();
+      if (pid == -1)
+      {
+        log_error("Fork failed, solving the remaining components in sequence");
+        fork_failed = true;
+        break;
+      }
+
+      if (!pid)
+      {
+        // The result travels back in the exit status, offset so that it is
+        // not mistaken for the status of an exit() elsewhere
+        smt_convt::resultt res = solve_component(eq, components, next);
+        fflush(stdout);
+        fflush(stderr);
+        _exit(component_exit_base + res);
+      }
+
+      running.emplace(pid, next++);
+    }
+
+    if (running.empty())
+      break;
+
+    int status;
+    pid_t pid = waitpid(-1, &status, 0);
+    if (pid == -1)
+    {
+      if (errno == EINTR)
+        continue;
+      log_error("Lost track of the component processes");
+      abort();
+    }
+
+    auto it = running.find(pid);
+    if (it == running.end())
+      continue;
+
+    // Anything but one of our exit statuses, e.g. a signal, is an error
+    smt_convt::resultt res = smt_convt::P_ERROR;
+    if (
+      WIFEXITED(status) &&
+      WEXITSTATUS(status) >= component_exit_base + smt_convt::P_UNSATISFIABLE &&
+      WEXITSTATUS(status) <= component_exit_base + smt_convt::P_SMTLIB)
+      res = smt_convt::resultt(WEXITSTATUS(status) - component_exit_base);
+
+    if (failed == SIZE_MAX && res == smt_convt::P_SATISFIABLE)
+    {
+      failed = it->second;
+      // Any counterexample will do, stop the others
+      for (const auto &[other, c] : running)
+        if (other != pid)
+          kill(other, SIGKILL);
+    }
+    else if (failed == SIZE_MAX && res != smt_convt::P_UNSATISFIABLE)
+      error = true;
+
+    running.erase(it);
+  }
+
+  if (fork_failed)
+    solve_in_sequence();
+#endif
+
+  if (failed == SIZE_MAX)
+    return error ? smt_convt::P_ERROR : smt_convt::P_UNSATISFIABLE;
+
+  log_status("Component {} has a counterexample", failed);
+  component_slicer slicer(components, failed);
+  slicer.run(eq.SSA_steps);
+  return run_decision_procedure(*runtime_solver, eq);
+}
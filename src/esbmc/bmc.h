@@ -67,6 +67,13 @@ protected:
     const symex_target_equationt &eq,
     size_t remaining_claims);
 
+  smt_convt::resultt parallel_components_check(symex_target_equationt &eq);
+
+  smt_convt::resultt solve_component(
+    const symex_target_equationt &eq,
+    const std::vector<size_t> &components,
+    size_t component);
+
   std::vector<std::unique_ptr<ssa_step_algorithm>> algorithms;
 
   void
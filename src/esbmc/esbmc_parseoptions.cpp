@@ -4,6 +4,7 @@
 extern "C"
 {
 #include <fcntl.h>
+#include <poll.h>
 #include <unistd.h>
 
 #ifdef HAVE_SENDFILE_ESBMC
@@ -11,18 +12,28 @@ extern "C"
 #endif
 
 #include <sys/resource.h>
+#include <sys/socket.h>
 #include <sys/time.h>
 #include <sys/types.h>
+#include <sys/un.h>
 }
 #endif
 
 #include <esbmc/bmc.h>
 #include <esbmc/esbmc_parseoptions.h>
 #include <cctype>
+#include <c2goto/cprover_library.h>
 #include <clang-c-frontend/clang_c_language.h>
 #include <util/config.h>
+#include <util/crypto_hash.h>
+#include <util/filesystem.h>
+#include <boost/filesystem.hpp>
+#include <boost/program_options/parsers.hpp>
+#include <cerrno>
 #include <csignal>
 #include <cstdlib>
+#include <cstring>
+#include <fstream>
 #include <util/expr_util.h>
 #include <iostream>
 #include <goto-programs/add_race_assertions.h>
@@ -34,7 +45,7 @@ extern "C"
 #include <goto-programs/abstract-interpretation/gcse.h>
 #include <goto-programs/loop_numbers.h>
 #include <goto-programs/read_goto_binary.h>
-#include <goto-programs/write_goto_binary.h>
+#include <goto-programs/goto_binary_index.h>
 #include <goto-programs/remove_no_op.h>
 #include <goto-programs/remove_unreachable.h>
 #include <goto-programs/set_claims.h>
@@ -45,11 +56,14 @@ extern "C"
 #include <util/irep.h>
 #include <langapi/languages.h>
 #include <langapi/mode.h>
+#include <map>
 #include <memory>
+#include <thread>
 #include <pointer-analysis/goto_program_dereference.h>
 #include <pointer-analysis/show_value_sets.h>
 #include <pointer-analysis/value_set_analysis.h>
 #include <util/symbol.h>
+#include <util/perf_report.h>
 #include <util/time_stopping.h>
 
 #ifndef _WIN32
@@ -64,6 +78,10 @@ extern "C"
 #include <goto-programs/goto_contractor.h>
 #endif
 
+static perf_countert symbols_count("symbols");
+static perf_countert goto_functions_count("goto-functions");
+static perf_countert goto_instructions_count("goto-instructions");
+
 extern "C" const char buildidstring_buf[];
 extern "C" const unsigned int buildidstring_buf_size;
 
@@ -72,6 +90,16 @@ static std::string_view esbmc_version_string()
   return {buildidstring_buf, buildidstring_buf_size};
 }
 
+// Identifies this build in the keys of the on-disk caches
+static std::string cache_build_id()
+{
+  std::string_view id = esbmc_version_string();
+  crypto_hash h;
+  h.ingest(id.data(), id.size());
+  h.fin();
+  return h.to_string();
+}
+
 enum PROCESS_TYPE
 {
   BASE_CASE,
@@ -291,6 +319,20 @@ void esbmc_parseoptionst::get_command_line_options(optionst &options)
   if (cmdline.isset("compact-trace"))
     options.set_option("no-slice", true);
 
+  // Entries of the GOTO conversion cache are only valid for this build
+  if (cmdline.isset("goto-cache"))
+    options.set_option("goto-cache-build-id", cache_build_id());
+
+  // Likewise for precompiled headers and the headers they are built from
+  if (cmdline.isset("pch-cache"))
+    options.set_option("pch-cache-build-id", cache_build_id());
+
+  if (cmdline.isset("ordered-address-space"))
+    log_warning(
+      "--ordered-address-space fixes the order of objects in memory and never "
+      "reuses freed memory: violations that depend on another layout are "
+      "missed");
+
   if (cmdline.isset("smt-during-symex"))
   {
     log_status("Enabling --no-slice due to presence of --smt-during-symex");
@@ -445,6 +487,9 @@ int esbmc_parseoptionst::doit()
     messaget::state.out = f;
   }
 
+  if (cmdline.isset("perf-report"))
+    perf_reportt::enable(cmdline.getval("perf-report"));
+
   // Print a banner
   log_status(
     "ESBMC version {} {}-bit {} {}",
@@ -463,6 +508,11 @@ int esbmc_parseoptionst::doit()
     return 1;
   }
 
+  // Every job of the server runs in a process of its own with its own
+  // options, so this is not combined with any of the steps below.
+  if (cmdline.isset("server"))
+    return doit_server();
+
   // Preprocess the input program.
   // (This will not have any effect if OLD_FRONTEND is not enabled.)
   if (cmdline.isset("preprocess"))
@@ -473,17 +523,22 @@ int esbmc_parseoptionst::doit()
 
   // Initialize goto_functions algorithms
   {
+    // Loop acceleration runs first so the unroller only sees what is left
+    if (cmdline.isset("goto-accelerate"))
+      goto_preprocess_algorithms.emplace_back(
+        "goto-accelerate", std::make_unique<loop_accelerator>(context));
+
     // Loop unrolling
     if (cmdline.isset("goto-unwind") && !cmdline.isset("unwind"))
     {
       size_t unroll_limit = cmdline.isset("unlimited-goto-unwind") ? -1 : 1000;
-      goto_preprocess_algorithms.push_back(
-        std::make_unique<bounded_loop_unroller>(unroll_limit));
+      goto_preprocess_algorithms.emplace_back(
+        "goto-unwind", std::make_unique<bounded_loop_unroller>(unroll_limit));
     }
 
     // Explicitly marking all declared variables as "nondet"
     goto_preprocess_algorithms.emplace_back(
-      std::make_unique<mark_decl_as_non_det>(context));
+      "mark-decl-as-nondet", std::make_unique<mark_decl_as_non_det>(context));
   }
 
   // Run this before the main flow. This method performs its own
@@ -1095,6 +1150,325 @@ int esbmc_parseoptionst::doit_k_induction_parallel()
   return 0;
 }
 
+#ifndef _WIN32
+namespace
+{
+/* A job of the verification server, running in a child process */
+struct server_jobt
+{
+  unsigned number;
+  // Connection the job was received on, or -1 when jobs are read from stdin
+  int conn;
+  // Output of the job, relayed once it has finished when reading from stdin
+  file_operations::tmp_file output;
+};
+} // namespace
+
+static bool
+has_option(const std::vector<std::string> &args, const std::string &name)
+{
+  std::string opt = "--" + name;
+  for (const std::string &arg : args)
+    if (arg == opt || arg.rfind(opt + "=", 0) == 0)
+      return true;
+  return false;
+}
+
+static std::string job_status(int status)
+{
+  if (WIFEXITED(status))
+    return fmt::format("exit {}", WEXITSTATUS(status));
+  if (WIFSIGNALED(status))
+    return fmt::format("signal {}", WTERMSIG(status));
+  return "unknown";
+}
+
+/* Seconds a client has to send the command line of its job */
+static const time_t server_read_timeout = 30;
+
+static bool read_line(int fd, std::string &line)
+{
+  line.clear();
+  char c;
+  ssize_t n;
+  while ((n = read(fd, &c, 1)) == 1 && c != '\n')
+    line += c;
+  return n == 1 || !line.empty();
+}
+#endif
+
+// Runs ESBMC as a server: every line read from stdin, or every connection
+// to the socket given by --server-socket, is the command line of a
+// verification job. Each job is run by a child forked from this process, so
+// the start-up of ESBMC (loading the executable, extracting the headers and
+// initialising the front-end) is only paid once, while the jobs stay as
+// isolated from each other as separate runs of ESBMC.
+int esbmc_parseoptionst::doit_server()
+{
+#ifdef _WIN32
+  log_error("Windows does not support the server mode");
+  return 1;
+#else
+  if (config.set(cmdline))
+    return 1;
+  set_verbosity_msg();
+
+  unsigned max_jobs = std::thread::hardware_concurrency();
+  if (cmdline.isset("server-jobs"))
+    max_jobs = atoi(cmdline.getval("server-jobs"));
+  max_jobs = std::max(max_jobs, 1u);
+
+  // Limits given to the server apply to every job not setting its own.
+  // Jobs share a header cache, so the headers are only extracted once.
+  std::vector<std::pair<std::string, std::string>> defaults;
+  for (const char *opt : {"timeout", "memlimit"})
+    if (cmdline.isset(opt))
+      defaults.emplace_back(opt, cmdline.getval(opt));
+
+  file_operations::tmp_path cache_dir;
+  std::string cache;
+  if (cmdline.isset("pch-cache"))
+  {
+    // Absolute, as jobs may run in other directories
+    cache = boost::filesystem::absolute(cmdline.getval("pch-cache")).string();
+  }
+  else
+  {
+    cache_dir = file_operations::create_tmp_dir("esbmc-server.%%%%-%%%%-%%%%");
+    cache = cache_dir.path();
+  }
+  defaults.emplace_back("pch-cache", cache);
+
+  // Prepare, before the first job is forked, the state all jobs share:
+  // creating the C front-end extracts the headers into the cache, and the
+  // internal C library is decoded once and kept in memory, so every child
+  // inherits it and only copies the symbols its program uses.
+  {
+    optionst options;
+    options.cmdline(cmdline);
+    options.set_option("pch-cache", cache);
+    options.set_option("pch-cache-build-id", cache_build_id());
+    config.options = options;
+
+    if (!new_language(language_idt::C))
+      log_warning("server: failed to initialise the C front-end");
+    preload_cprover_library();
+  }
+
+  int listener = -1;
+  std::map<pid_t, server_jobt> running;
+  unsigned jobs = 0;
+
+  // Runs the job `line`, or the one read from `conn` if `line` is empty, in
+  // the directory `dir`, or in the current one if `dir` is empty
+  auto spawn = [&](const std::string &line, int conn, const std::string &dir) {
+    server_jobt job;
+    job.number = ++jobs;
+    job.conn = conn;
+    int out_fd = conn;
+    if (conn < 0)
+    {
+      job.output = file_operations::create_tmp_file("esbmc-job.%%%%-%%%%");
+      out_fd = fileno(job.output.file());
+    }
+
+    // Don't let the child inherit and write out our buffered output
+    fflush(stdout);
+    fflush(stderr);
+
+    pid_t pid = fork();
+    if (pid == -1)
+    {
+      log_error("server: fork failed for job {}", job.number);
+      if (conn >= 0)
+        close(conn);
+      return;
+    }
+
+    if (!pid)
+    {
+      // Only keep the connection of this job open
+      if (listener >= 0)
+        close(listener);
+      for (const auto &[other, other_job] : running)
+        if (other_job.conn >= 0)
+          close(other_job.conn);
+
+      dup2(out_fd, STDOUT_FILENO);
+      dup2(out_fd, STDERR_FILENO);
+
+      // The command line of a connection is read here rather than by the
+      // server, so that a client that does not send it only holds up itself
+      std::string cmd = line;
+      if (cmd.empty() && (!read_line(conn, cmd) || cmd.empty()))
+      {
+        log_error("server: no job received");
+        fflush(stderr);
+        _exit(1);
+      }
+
+      std::vector<std::string> args;
+      try
+      {
+        args = boost::program_options::split_unix(cmd);
+      }
+      catch (const std::exception &e)
+      {
+        log_error("server: malformed job `{}': {}", cmd, e.what());
+        fflush(stderr);
+        _exit(1);
+      }
+
+      for (const auto &[opt, value] : defaults)
+        if (!has_option(args, opt))
+        {
+          args.push_back("--" + opt);
+          args.push_back(value);
+        }
+
+      if (!dir.empty() && chdir(dir.c_str()))
+      {
+        log_error("server: cannot enter `{}': {}", dir, strerror(errno));
+        fflush(stderr);
+        _exit(1);
+      }
+
+      std::string exe = executable_path.string();
+      std::vector<const char *> argv = {exe.c_str()};
+      for (const std::string &arg : args)
+        argv.push_back(arg.c_str());
+
+      esbmc_parseoptionst parseoptions(argv.size(), argv.data());
+      int status = parseoptions.main();
+      fflush(stdout);
+      fflush(stderr);
+      // Skip the destructors of the objects shared with the server
+      _exit(status);
+    }
+
+    running.emplace(pid, std::move(job));
+  };
+
+  // Reaps a finished job, waiting for one if `block` is set. Returns
+  // whether a job was reaped.
+  auto reap = [&](bool block) {
+    int status;
+    pid_t pid = waitpid(-1, &status, block ? 0 : WNOHANG);
+    if (pid <= 0)
+      return false;
+
+    auto it = running.find(pid);
+    if (it == running.end())
+      return true;
+
+    server_jobt &job = it->second;
+    std::string trailer = fmt::format(
+      "### esbmc-server job {}: {}\n", job.number, job_status(status));
+
+    if (job.conn >= 0)
+    {
+      if (FILE *f = fdopen(job.conn, "w"))
+      {
+        fputs(trailer.c_str(), f);
+        fclose(f);
+      }
+      else
+        close(job.conn);
+    }
+    else
+    {
+      FILE *f = job.output.file();
+      rewind(f);
+      char buf[BUFSIZ];
+      for (size_t n; (n = fread(buf, 1, sizeof(buf), f)) > 0;)
+        fwrite(buf, 1, n, stdout);
+      fputs(trailer.c_str(), stdout);
+      fflush(stdout);
+    }
+
+    running.erase(it);
+    return true;
+  };
+
+  auto serve = [&](std::istream &in, const std::string &dir) {
+    std::string line;
+    while (std::getline(in, line))
+    {
+      if (line.empty())
+        continue;
+      if (running.size() >= max_jobs)
+        reap(true);
+      spawn(line, -1, dir);
+    }
+  };
+
+  if (!cmdline.isset("server-socket"))
+  {
+    // Jobs listed in a file run in the directory of that file
+    for (const std::string &file : cmdline.args)
+    {
+      std::ifstream in(file);
+      if (!in)
+      {
+        log_error("server: failed to open job file `{}'", file);
+        return 1;
+      }
+      serve(in, boost::filesystem::path(file).parent_path().string());
+    }
+    if (cmdline.args.empty())
+      serve(std::cin, "");
+
+    while (!running.empty())
+      reap(true);
+    return 0;
+  }
+
+  std::string path = cmdline.getval("server-socket");
+  sockaddr_un addr = {};
+  addr.sun_family = AF_UNIX;
+  if (path.size() >= sizeof(addr.sun_path))
+  {
+    log_error("server: socket path `{}' is too long", path);
+    return 1;
+  }
+  path.copy(addr.sun_path, path.size());
+
+  unlink(path.c_str());
+  listener = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (
+    listener < 0 ||
+    bind(listener, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) ||
+    listen(listener, SOMAXCONN))
+  {
+    log_error("server: cannot listen on `{}': {}", path, strerror(errno));
+    return 1;
+  }
+  log_status("Waiting for jobs on {}", path);
+
+  for (;;)
+  {
+    if (running.size() >= max_jobs)
+      reap(true);
+    while (reap(false))
+      ;
+
+    // Wake up regularly to pass on the results of finished jobs
+    pollfd pfd = {listener, POLLIN, 0};
+    if (poll(&pfd, 1, running.empty() ? -1 : 100) <= 0)
+      continue;
+
+    int conn = accept(listener, nullptr, nullptr);
+    if (conn < 0)
+      continue;
+
+    // Don't let a silent client hold its job slot forever
+    timeval timeout = {server_read_timeout, 0};
+    setsockopt(conn, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    spawn("", conn, "");
+  }
+#endif
+}
+
 // This method iteratively applies one of the verification strategies
 // for different unwinding bounds up to the specified maximum depth.
 //
@@ -1540,6 +1914,7 @@ bool esbmc_parseoptionst::create_goto_program(
 bool esbmc_parseoptionst::read_goto_binary(goto_functionst &goto_functions)
 {
   log_progress("Reading GOTO program from file");
+  perf_phaset phase("read-goto-binary");
   for (const auto &arg : cmdline.args)
   {
     if (::read_goto_binary(arg, context, goto_functions))
@@ -1562,8 +1937,11 @@ bool esbmc_parseoptionst::parse_goto_program(
 {
   try
   {
-    if (parse(cmdline))
-      return true;
+    {
+      perf_phaset phase("parse");
+      if (parse(cmdline))
+        return true;
+    }
 
     if (cmdline.isset("parse-tree-too") || cmdline.isset("parse-tree-only"))
     {
@@ -1577,10 +1955,14 @@ bool esbmc_parseoptionst::parse_goto_program(
     }
 
     // Typecheking (old frontend) or adjust (clang frontend)
-    if (typecheck())
-      return true;
-    if (final())
-      return true;
+    {
+      perf_phaset phase("typecheck");
+      if (typecheck())
+        return true;
+      if (final())
+        return true;
+    }
+    symbols_count.add(context.size());
 
     // we no longer need any parse trees or language files
     clear_parse();
@@ -1595,6 +1977,7 @@ bool esbmc_parseoptionst::parse_goto_program(
     }
 
     log_progress("Generating GOTO Program");
+    perf_phaset phase("goto-convert");
     goto_convert(context, options, goto_functions);
   }
 
@@ -1639,6 +2022,7 @@ bool esbmc_parseoptionst::process_goto_program(
   try
   {
     namespacet ns(context);
+    perf_phaset phase("goto-programs");
 
     bool is_no_remove = cmdline.isset("multi-property") ||
                         cmdline.isset("goto-coverage") ||
@@ -1646,22 +2030,32 @@ bool esbmc_parseoptionst::process_goto_program(
 
     // Start by removing all no-op instructions and unreachable code
     if (!(cmdline.isset("no-remove-no-op")))
+    {
+      perf_phaset phase("remove-no-op");
       remove_no_op(goto_functions);
+    }
 
     // We should skip this 'remove-unreachable' removal in goto-cov and multi-property
     // - multi-property wants to find all the bugs in the src code
     // - goto-coverage wants to find out unreached codes (asserts)
     // - however, the optimisation below will remove codes during the Goto stage
     if (!(cmdline.isset("no-remove-unreachable") || is_no_remove))
+    {
+      perf_phaset phase("remove-unreachable");
       remove_unreachable(goto_functions);
+    }
 
     // Apply all the initialized algorithms
-    for (auto &algorithm : goto_preprocess_algorithms)
+    for (auto &[name, algorithm] : goto_preprocess_algorithms)
+    {
+      perf_phaset phase(name);
       algorithm->run(goto_functions);
+    }
 
     // do partial inlining
     if (!cmdline.isset("no-inlining"))
     {
+      perf_phaset phase("inline");
       if (cmdline.isset("full-inlining"))
         goto_inline(goto_functions, options, ns);
       else
@@ -1670,6 +2064,7 @@ bool esbmc_parseoptionst::process_goto_program(
 
     if (cmdline.isset("gcse"))
     {
+      perf_phaset phase("gcse");
       std::shared_ptr<value_set_analysist> vsa =
         std::make_shared<value_set_analysist>(ns);
       try
@@ -1706,6 +2101,7 @@ bool esbmc_parseoptionst::process_goto_program(
 
     if (cmdline.isset("interval-analysis") || cmdline.isset("goto-contractor"))
     {
+      perf_phaset phase("interval-analysis");
       interval_analysis(goto_functions, ns, options);
     }
 
@@ -1713,6 +2109,7 @@ bool esbmc_parseoptionst::process_goto_program(
       cmdline.isset("inductive-step") || cmdline.isset("k-induction") ||
       cmdline.isset("k-induction-parallel"))
     {
+      perf_phaset phase("k-induction");
       // Always remove skips before doing k-induction.
       // It seems to fix some issues for now
       remove_no_op(goto_functions);
@@ -1724,6 +2121,7 @@ bool esbmc_parseoptionst::process_goto_program(
       cmdline.isset("goto-contractor-condition"))
     {
 #ifdef ENABLE_GOTO_CONTRACTOR
+      perf_phaset phase("goto-contractor");
       goto_contractor(goto_functions, ns, options);
 #else
       log_error(
@@ -1735,23 +2133,36 @@ bool esbmc_parseoptionst::process_goto_program(
     }
 
     if (cmdline.isset("termination"))
+    {
+      perf_phaset phase("termination");
       goto_termination(goto_functions);
+    }
 
-    goto_check(ns, options, goto_functions);
+    {
+      perf_phaset phase("goto-check");
+      goto_check(ns, options, goto_functions);
+    }
 
     // Once again, remove all unreachable and no-op code that could have been
     // introduced by the above algorithms
     if (!(cmdline.isset("no-remove-no-op")))
+    {
+      perf_phaset phase("remove-no-op");
       remove_no_op(goto_functions);
+    }
 
     if (!(cmdline.isset("no-remove-unreachable") || is_no_remove))
+    {
+      perf_phaset phase("remove-unreachable");
       remove_unreachable(goto_functions);
+    }
 
     goto_functions.update();
 
     if (cmdline.isset("data-races-check"))
     {
       log_status("Adding Data Race Checks");
+      perf_phaset phase("data-races-check");
 
       value_set_analysist value_set_analysis(ns);
       value_set_analysis(goto_functions);
@@ -1784,6 +2195,16 @@ bool esbmc_parseoptionst::process_goto_program(
       tmp.make_asserts_false(goto_functions, ns);
       tmp.gen_assert_instance(goto_functions);
     }
+
+    if (perf_reportt::enabled())
+    {
+      uint64_t instructions = 0;
+      forall_goto_functions (it, goto_functions)
+        instructions += it->second.body.instructions.size();
+
+      goto_functions_count.add(goto_functions.function_map.size());
+      goto_instructions_count.add(instructions);
+    }
   }
 
   catch (const char *e)
@@ -1849,7 +2270,7 @@ bool esbmc_parseoptionst::output_goto_program(
       log_status("Writing GOTO program to file");
       std::ofstream oss(
         cmdline.getval("output-goto"), std::ios::out | std::ios::binary);
-      if (write_goto_binary(oss, context, goto_functions))
+      if (write_goto_binary_index(oss, context, goto_functions))
       {
         log_error("Failed to generate goto binary file"); // TODO: explain why
         abort();
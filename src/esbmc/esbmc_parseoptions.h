@@ -51,6 +51,8 @@ protected:
 
   int doit_k_induction_parallel();
 
+  int doit_server();
+
   tvt is_base_case_violated(
     optionst &options,
     goto_functionst &goto_functions,
@@ -79,7 +81,9 @@ protected:
 
   FILE *out = stderr;
 
-  std::vector<std::unique_ptr<goto_functions_algorithm>>
+  // Each algorithm is timed as a phase of its own name
+  std::vector<
+    std::pair<const char *, std::unique_ptr<goto_functions_algorithm>>>
     goto_preprocess_algorithms;
 
 private:
@@ -3,9 +3,12 @@
 #include <langapi/mode.h>
 
 #include <irep2/irep2.h>
+#include <util/perf_report.h>
 
 int main(int argc, const char **argv)
 {
   esbmc_parseoptionst parseoptions(argc, argv);
-  return parseoptions.main();
+  int res = parseoptions.main();
+  perf_reportt::write(res);
+  return res;
 }
@@ -111,6 +111,23 @@ const struct group_opt_templ all_cmd_options[] = {
      boost::program_options::value<std::string>(),
      "export generated goto program"},
     {"binary", NULL, "read goto program instead of source code"},
+    {"goto-cache",
+     boost::program_options::value<std::string>()->value_name("dir"),
+     "cache converted function bodies in dir and reuse them across runs"},
+    {"prefix-header",
+     boost::program_options::value<std::string>()->value_name("file"),
+     "include file at the beginning of every C/C++ input file"},
+    {"pch-cache",
+     boost::program_options::value<std::string>()->value_name("dir"),
+     "keep the precompiled prefix header and ESBMC's headers in dir and reuse "
+     "them across runs"},
+    {"python-ast-cache",
+     boost::program_options::value<std::string>()->value_name("dir"),
+     "cache the ASTs of Python input files in dir and reuse them across runs"},
+    {"parse-jobs",
+     boost::program_options::value<int>()->value_name("n"),
+     "parse up to n C/C++ input files concurrently (default: number of "
+     "cores)"},
     {"little-endian", NULL, "allow little-endian word-byte conversions"},
     {"big-endian", NULL, "allow big-endian word-byte conversions"},
     {"16", NULL, "set width of machine word (default is 64)"},
@@ -135,6 +152,9 @@ const struct group_opt_templ all_cmd_options[] = {
      boost::program_options::value<std::string>()->value_name("{ path | - }"),
      "generate the verification result witness in GraphML format; use '-' for "
      "output to stdout"},
+    {"witness-compact",
+     NULL,
+     "write the GraphML witness without indentation and line breaks"},
     {"witness-producer", boost::program_options::value<std::string>(), ""},
     {"witness-programfile", boost::program_options::value<std::string>(), ""},
     {"old-frontend",
@@ -200,10 +220,17 @@ const struct group_opt_templ all_cmd_options[] = {
        "id"),
      "disable slicing for the symbol with the given id"},
     {"goto-unwind", NULL, "unroll bounded loops at goto level"},
+    {"goto-accelerate",
+     NULL,
+     "replace simple counting loops by their closed form at goto level"},
     {"unlimited-goto-unwind",
      NULL,
      "do not unroll bounded loops at goto level"},
     {"slice-assumes", NULL, "remove unused assume statements"},
+    {"ssa-preprocess",
+     NULL,
+     "propagate, inline and merge definitions across the SSA formula before "
+     "encoding it"},
     {"extended-try-analysis", NULL, ""},
     {"skip-bmc", NULL, ""}}},
   {"Incremental BMC",
@@ -261,6 +288,18 @@ const struct group_opt_templ all_cmd_options[] = {
      NULL,
      "encode tuples using our tuple to symbol API"},
     {"array-flattener", NULL, "encode arrays using our array API"},
+    {"array-flattener-lazy",
+     NULL,
+     "with the array API, only encode the read-over-write and Ackermann "
+     "constraints of arrays that a model violates, and solve again (ignored "
+     "when the formula is only written out)"},
+    {"ordered-address-space",
+     NULL,
+     "lay out objects in the address space in the order they are encoded, "
+     "with one constraint per object rather than one per pair of objects; "
+     "unsound: comparisons of addresses of different objects only take the "
+     "values of that order and freed memory is never reused, so violations "
+     "that depend on another layout are missed"},
     {"no-return-value-opt",
      NULL,
      "disable return value optimization to compute the stack size"}}},
@@ -278,11 +317,17 @@ const struct group_opt_templ all_cmd_options[] = {
      "{experimental},"},
     {"smt-symex-assert",
      NULL,
-     "check assertion statements during symbolic execution {experimental},"}}},
+     "check assertion statements during symbolic execution {experimental},"},
+    {"smt-symex-budget",
+     boost::program_options::value<int>()->value_name("n"),
+     "ask the solver at most n questions during symbolic execution"}}},
   {"Property checking",
    {{"multi-property",
      NULL,
      "verify satisfiability of all claims of the current bound"},
+    {"parallel-components",
+     NULL,
+     "solve independent components of the formula in parallel processes"},
     {"no-assertions", NULL, "ignore assertions"},
     {"no-bounds-check", NULL, "do not do array bounds check"},
     {"no-div-by-zero-check", NULL, "do not do division by zero check"},
@@ -331,6 +376,11 @@ const struct group_opt_templ all_cmd_options[] = {
      "check if label is unreachable"},
     {"force-malloc-success", NULL, "do not check for malloc/new failure"},
     {"malloc-zero-is-null", NULL, "force malloc(0) to return NULL"},
+    {"byte-array-heap",
+     NULL,
+     "model heap objects without pointers whose type the program also "
+     "accesses as another type as arrays of bytes, which keeps type-punned "
+     "accesses to them linear in the size of the access"},
     {"enable-unreachability-intrinsic",
      NULL,
      "enable the functionality of the __ESBMC_unreachable() intrinsic, which "
@@ -444,10 +494,28 @@ const struct group_opt_templ all_cmd_options[] = {
      "configure memory limit, of form \"100m\" or \"2g\"; without suffix the "
      "default unit is 'm'."},
     {"memstats", NULL, "print memory usage statistics"},
+    {"perf-report",
+     boost::program_options::value<std::string>()->value_name("file"),
+     "write the time and peak memory of each phase and other performance "
+     "counters as JSON to file"},
     {"timeout",
      boost::program_options::value<std::string>()->value_name("t"),
      "configure time limit, integer followed by {s,m,h}"},
     {"enable-core-dump", NULL, "do not disable core dump output"},
+    {"server",
+     NULL,
+     "run as a server: read verification jobs from the given files, or from "
+     "stdin if there are none, one command line per line, and run each in a "
+     "process forked from the server; jobs from a file run in its directory "
+     "and the output of a job is followed by a line \"### esbmc-server job "
+     "N: exit S\""},
+    {"server-socket",
+     boost::program_options::value<std::string>()->value_name("path"),
+     "with --server, accept jobs on a Unix socket at path instead, one per "
+     "connection, and reply with the output of the job"},
+    {"server-jobs",
+     boost::program_options::value<int>()->value_name("n"),
+     "with --server, run up to n jobs at once (default: number of cores)"},
     {"no-simplify", NULL, "do not simplify any expression"},
     {"no-propagation", NULL, "disable constant propagation"},
     {"gcse",
@@ -0,0 +1,372 @@
+#include <algorithm>
+#include <functional>
+#include <goto-programs/goto_binary_index.h>
+#include <goto-programs/goto_program_irep.h>
+#include <set>
+#include <sstream>
+#include <unordered_map>
+#include <util/irep_serialization.h>
+
+namespace
+{
+/* Writes ireps into a record. Nodes are only shared within the current
+ * record, strings are shared by the whole file. */
+class index_writert
+{
+public:
+  std::vector<irep_idt> string_table;
+
+  void write(std::ostream &out, const irept &irep)
+  {
+    auto [it, ins] = ireps.try_emplace(irep, ireps.size());
+    write_long(out, it->second);
+    if (!ins)
+      return;
+
+    write_long(out, string_ref(irep.id()));
+
+    forall_irep (sub, irep.get_sub())
+    {
+      out.put('S');
+      write(out, *sub);
+    }
+
+    forall_named_irep (sub, irep.get_named_sub())
+    {
+      out.put('N');
+      write_long(out, string_ref(sub->first));
+      write(out, sub->second);
+    }
+
+    forall_named_irep (sub, irep.get_comments())
+    {
+      out.put('C');
+      write_long(out, string_ref(sub->first));
+      write(out, sub->second);
+    }
+
+    out.put(0);
+  }
+
+  void new_record()
+  {
+    ireps.clear();
+  }
+
+  unsigned string_ref(const irep_idt &s)
+  {
+    auto [it, ins] = strings.try_emplace(s.get_no(), string_table.size());
+    if (ins)
+      string_table.push_back(s);
+    return it->second;
+  }
+
+protected:
+  std::unordered_map<irept, unsigned, irep_full_hash, irep_full_eq> ireps;
+  std::unordered_map<unsigned, unsigned> strings;
+};
+
+/* Bounds-checked cursor into the data of an index */
+class readert
+{
+public:
+  readert(const unsigned char *p, const unsigned char *end) : p(p), end(end)
+  {
+  }
+
+  const unsigned char *p;
+  const unsigned char *end;
+
+  bool has(size_t n) const
+  {
+    return (size_t)(end - p) >= n;
+  }
+
+  unsigned read_long()
+  {
+    if (!has(4))
+      throw "truncated goto binary";
+    unsigned res = (p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+    p += 4;
+    return res;
+  }
+
+  int get()
+  {
+    if (!has(1))
+      throw "truncated goto binary";
+    return *p++;
+  }
+
+  int peek() const
+  {
+    return has(1) ? *p : -1;
+  }
+};
+} // namespace
+
+static void generate_symbol_deps(const irept &irep, std::set<irep_idt> &deps)
+{
+  if (irep.id() == "symbol")
+  {
+    deps.insert(irep.identifier());
+    return;
+  }
+
+  forall_irep (irep_it, irep.get_sub())
+  {
+    if (irep_it->id() == "symbol")
+    {
+      deps.insert(irep_it->identifier());
+      generate_symbol_deps(*irep_it, deps);
+    }
+    else if (irep_it->id() == "argument")
+      deps.insert(irep_it->cmt_identifier());
+    else
+      generate_symbol_deps(*irep_it, deps);
+  }
+
+  forall_named_irep (irep_it, irep.get_named_sub())
+  {
+    if (irep_it->second.id() == "symbol")
+      deps.insert(irep_it->second.identifier());
+    else if (irep_it->second.id() == "argument")
+      deps.insert(irep_it->second.cmt_identifier());
+    else
+      generate_symbol_deps(irep_it->second, deps);
+  }
+}
+
+bool write_goto_binary_index(
+  std::ostream &out,
+  const contextt &context,
+  goto_functionst &functions)
+{
+  index_writert writer;
+  std::ostringstream records;
+
+  std::vector<const symbolt *> symbols;
+  std::unordered_map<irep_idt, unsigned, irep_id_hash> symbol_idx;
+  context.foreach_operand_in_order([&symbols, &symbol_idx](const symbolt &s) {
+    symbol_idx.emplace(s.id, symbols.size());
+    symbols.push_back(&s);
+  });
+
+  std::ostringstream symbol_toc;
+  for (const symbolt *s : symbols)
+  {
+    write_long(symbol_toc, writer.string_ref(s->id));
+    write_long(symbol_toc, static_cast<unsigned>(records.tellp()));
+
+    std::set<irep_idt> names;
+    generate_symbol_deps(s->value, names);
+    generate_symbol_deps(s->type, names);
+
+    std::vector<unsigned> deps;
+    for (const irep_idt &name : names)
+    {
+      auto it = symbol_idx.find(name);
+      if (it != symbol_idx.end() && it->first != s->id)
+        deps.push_back(it->second);
+    }
+    std::sort(deps.begin(), deps.end());
+
+    write_long(symbol_toc, deps.size());
+    for (unsigned d : deps)
+      write_long(symbol_toc, d);
+
+    irept irep;
+    s->to_irep(irep);
+    writer.new_record();
+    writer.write(records, irep);
+  }
+
+  unsigned nfunctions = 0;
+  std::ostringstream function_toc;
+  for (auto &[name, f] : functions.function_map)
+  {
+    if (!f.body_available)
+      continue;
+
+    write_long(function_toc, writer.string_ref(name));
+    write_long(function_toc, static_cast<unsigned>(records.tellp()));
+    nfunctions++;
+
+    irept irep;
+    f.body.compute_location_numbers();
+    convert(f.body, irep);
+    writer.new_record();
+    writer.write(records, irep);
+  }
+
+  std::ostringstream string_table;
+  for (const irep_idt &s : writer.string_table)
+  {
+    const std::string &str = s.as_string();
+    write_long(string_table, str.size());
+    string_table.write(str.data(), str.size());
+  }
+
+  // Header: magic, version and five counts/offsets of 4 bytes each
+  const size_t header_size = 3 + 4 * 5;
+  size_t records_offset = header_size + string_table.str().size() +
+                          symbol_toc.str().size() + function_toc.str().size();
+
+  out << "GBF";
+  write_long(out, GOTO_BINARY_INDEX_VERSION);
+  write_long(out, writer.string_table.size());
+  write_long(out, symbols.size());
+  write_long(out, nfunctions);
+  write_long(out, records_offset);
+  out << string_table.str() << symbol_toc.str() << function_toc.str()
+      << records.str();
+
+  return !out.good();
+}
+
+bool goto_binary_indext::open(const void *data, size_t size)
+{
+  begin = static_cast<const unsigned char *>(data);
+  end = begin + size;
+
+  try
+  {
+    readert in(begin, end);
+    if (
+      !in.has(3) || in.get() != 'G' || in.get() != 'B' || in.get() != 'F' ||
+      in.read_long() != GOTO_BINARY_INDEX_VERSION)
+      return true;
+
+    unsigned nstrings = in.read_long();
+    unsigned nsymbols = in.read_long();
+    unsigned nfunctions = in.read_long();
+    unsigned records_offset = in.read_long();
+    if (records_offset > size)
+      return true;
+    records = begin + records_offset;
+
+    // every string and table entry takes at least 4 bytes
+    if (!in.has(4 * ((size_t)nstrings + nsymbols + nfunctions)))
+      return true;
+
+    string_pos.clear();
+    string_pos.reserve(nstrings);
+    for (unsigned i = 0; i < nstrings; i++)
+    {
+      unsigned len = in.read_long();
+      if (!in.has(len))
+        return true;
+      string_pos.emplace_back(in.p, len);
+      in.p += len;
+    }
+    strings.assign(nstrings, irep_idt());
+    interned.assign(nstrings, false);
+
+    symbols.resize(nsymbols);
+    for (entryt &e : symbols)
+    {
+      e.name = in.read_long();
+      e.offset = in.read_long();
+      unsigned ndeps = in.read_long();
+      if (!in.has(4 * (size_t)ndeps))
+        return true;
+      e.deps.resize(ndeps);
+      for (unsigned &d : e.deps)
+      {
+        d = in.read_long();
+        if (d >= nsymbols)
+          return true;
+      }
+      if (e.name >= nstrings || e.offset >= size - records_offset)
+        return true;
+    }
+
+    functions.resize(nfunctions);
+    for (entryt &e : functions)
+    {
+      e.name = in.read_long();
+      e.offset = in.read_long();
+      if (e.name >= nstrings || e.offset >= size - records_offset)
+        return true;
+    }
+  }
+  catch (const char *)
+  {
+    return true;
+  }
+
+  return false;
+}
+
+const irep_idt &goto_binary_indext::string(unsigned i)
+{
+  if (!interned[i])
+  {
+    const auto &[p, len] = string_pos[i];
+    strings[i] = irep_idt(std::string(reinterpret_cast<const char *>(p), len));
+    interned[i] = true;
+  }
+  return strings[i];
+}
+
+void goto_binary_indext::read_record(unsigned offset, irept &dest)
+{
+  readert in(records + offset, end);
+  std::vector<irept> ireps;
+
+  auto checked_string = [this](unsigned i) -> const irep_idt & {
+    if (i >= strings.size())
+      throw "malformed goto binary";
+    return string(i);
+  };
+
+  std::function<void(irept &)> read = [&](irept &irep) {
+    unsigned id = in.read_long();
+    if (id < ireps.size())
+    {
+      irep = ireps[id];
+      return;
+    }
+
+    if (id != ireps.size())
+      throw "malformed goto binary";
+    ireps.emplace_back();
+
+    irep.id(checked_string(in.read_long()));
+
+    while (in.peek() == 'S')
+    {
+      in.get();
+      irep.get_sub().emplace_back();
+      read(irep.get_sub().back());
+    }
+
+    while (in.peek() == 'N' || in.peek() == 'C')
+    {
+      in.get();
+      irept &r = irep.add(checked_string(in.read_long()));
+      read(r);
+    }
+
+    if (in.get() != 0)
+      throw "malformed goto binary";
+
+    ireps[id] = irep;
+  };
+
+  read(dest);
+}
+
+void goto_binary_indext::read_symbol(unsigned i, symbolt &dest)
+{
+  irept irep;
+  read_record(symbols[i].offset, irep);
+  dest.from_irep(irep);
+}
+
+void goto_binary_indext::read_function(unsigned i, goto_programt &dest)
+{
+  irept irep;
+  read_record(functions[i].offset, irep);
+  convert(irep, dest);
+}
@@ -0,0 +1,99 @@
+#ifndef CPROVER_GOTO_PROGRAMS_GOTO_BINARY_INDEX_H
+#define CPROVER_GOTO_PROGRAMS_GOTO_BINARY_INDEX_H
+
+#include <goto-programs/goto_functions.h>
+#include <ostream>
+#include <util/context.h>
+
+#define GOTO_BINARY_INDEX_VERSION 2
+
+/* Indexed goto binaries.
+ *
+ * Unlike the stream written by write_goto_binary(), every symbol and every
+ * function body is stored in a self-contained record whose ireps only share
+ * nodes within that record. Strings are kept in a single table for the whole
+ * file. The header lists, for each symbol, the offset of its record and the
+ * symbols of this file it refers to, so a reader can compute which symbols it
+ * needs and deserialise just those:
+ *
+ *   "GBF" version nstrings nsymbols nfunctions records_offset
+ *   strings:   (length bytes)*
+ *   symbols:   (name offset ndeps dep*)*
+ *   functions: (name offset)*
+ *   records
+ *
+ * All numbers are written by write_long(); names are indices into the string
+ * table and offsets are relative to the start of the records. Nothing needs
+ * to be decoded up front, so read_goto_binary() maps the file and only
+ * deserialises the records that are asked for.
+ */
+
+bool write_goto_binary_index(
+  std::ostream &out,
+  const contextt &context,
+  goto_functionst &functions);
+
+/* Random access to an indexed goto binary held in memory. The data is not
+ * copied and has to outlive the index. */
+class goto_binary_indext
+{
+public:
+  /// Parse the header and the tables of contents of [data, data + size).
+  /// Returns true on error, e.g. when this is not an indexed goto binary.
+  bool open(const void *data, size_t size);
+
+  size_t symbol_count() const
+  {
+    return symbols.size();
+  }
+
+  const irep_idt &symbol_name(unsigned i)
+  {
+    return string(symbols[i].name);
+  }
+
+  /// Indices of the symbols of this file that symbol \p i refers to.
+  const std::vector<unsigned> &symbol_deps(unsigned i) const
+  {
+    return symbols[i].deps;
+  }
+
+  void read_symbol(unsigned i, symbolt &dest);
+
+  size_t function_count() const
+  {
+    return functions.size();
+  }
+
+  const irep_idt &function_name(unsigned i)
+  {
+    return string(functions[i].name);
+  }
+
+  void read_function(unsigned i, goto_programt &dest);
+
+protected:
+  struct entryt
+  {
+    unsigned name;
+    unsigned offset;
+    std::vector<unsigned> deps;
+  };
+
+  const unsigned char *begin = nullptr;
+  const unsigned char *end = nullptr;
+  const unsigned char *records = nullptr;
+
+  // Positions of the strings in the table, interned on first use
+  std::vector<std::pair<const unsigned char *, unsigned>> string_pos;
+  std::vector<irep_idt> strings;
+  std::vector<bool> interned;
+
+  std::vector<entryt> symbols;
+  std::vector<entryt> functions;
+
+  const irep_idt &string(unsigned i);
+  void read_record(unsigned offset, irept &dest);
+};
+
+#endif
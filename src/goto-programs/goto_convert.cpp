@@ -660,6 +660,7 @@ void goto_convertt::convert_decl(const codet &code, goto_programt &dest)
     // This means that it was a VLA declaration and we need to
     // to rewrite the symbol as well
     s->type = var.type();
+    touched_symbols.push_back(s->id);
   }
 
   exprt initializer = nil_exprt();
@@ -2016,7 +2017,9 @@ void goto_convertt::generate_conditional_branch(
 
 symbolt &goto_convertt::new_tmp_symbol(const typet &type)
 {
-  return tmp_symbol.new_symbol(context, type, "tmp$");
+  symbolt &symbol = tmp_symbol.new_symbol(context, type, "tmp$");
+  touched_symbols.push_back(symbol.id);
+  return symbol;
 }
 
 void goto_convertt::unwind_destructor_stack(
@@ -0,0 +1,269 @@
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <goto-programs/goto_convert_cache.h>
+#include <goto-programs/goto_program_irep.h>
+#include <goto-programs/goto_program_serialization.h>
+#include <goto-programs/write_goto_binary.h>
+#include <set>
+#include <util/config.h>
+#include <util/crypto_hash.h>
+#include <util/irep_serialization.h>
+#include <util/namespace.h>
+#include <util/symbol_serialization.h>
+
+#define GOTO_CONVERT_CACHE_VERSION 1
+
+// Options read by goto_convertt; they change the produced program and thus
+// have to be part of every key.
+static const char *const conversion_options[] = {
+  "error-label",
+  "no-vla-size-check",
+  "atomicity-check",
+  "no-assertions",
+  "goto-cache-build-id"};
+
+static void hash_string(crypto_hash &h, const std::string &s)
+{
+  // include the terminator so that concatenations can't collide
+  h.ingest(s.c_str(), s.size() + 1);
+}
+
+static void hash_named_sub(
+  crypto_hash &h,
+  const char *tag,
+  const irept::named_subt &named_sub);
+
+/* Named sub-ireps are ordered by their string number, which depends on the
+ * order strings were interned in this run. Hash them in lexicographical order
+ * of their names instead, so that keys are stable across runs. */
+static void hash_irep(crypto_hash &h, const irept &irep)
+{
+  hash_string(h, irep.id_string());
+
+  forall_irep (it, irep.get_sub())
+  {
+    h.ingest("S", 1);
+    hash_irep(h, *it);
+  }
+
+  hash_named_sub(h, "N", irep.get_named_sub());
+  hash_named_sub(h, "C", irep.get_comments());
+
+  h.ingest("", 1);
+}
+
+static void hash_named_sub(
+  crypto_hash &h,
+  const char *tag,
+  const irept::named_subt &named_sub)
+{
+  std::vector<std::pair<const std::string *, const irept *>> sorted;
+  sorted.reserve(named_sub.size());
+  forall_named_irep (it, named_sub)
+    sorted.emplace_back(&name2string(it->first), &it->second);
+
+  std::sort(sorted.begin(), sorted.end(), [](const auto &a, const auto &b) {
+    return *a.first < *b.first;
+  });
+
+  for (const auto &[name, sub] : sorted)
+  {
+    h.ingest(tag, 1);
+    hash_string(h, *name);
+    hash_irep(h, *sub);
+  }
+}
+
+static void collect_identifiers(const irept &irep, std::set<std::string> &ids)
+{
+  if (irep.id() == "symbol" && !irep.identifier().empty())
+    ids.insert(irep.identifier().as_string());
+
+  forall_irep (it, irep.get_sub())
+    collect_identifiers(*it, ids);
+
+  forall_named_irep (it, irep.get_named_sub())
+    collect_identifiers(it->second, ids);
+}
+
+goto_convert_cachet::goto_convert_cachet(
+  const std::string &dir,
+  const optionst &options)
+  : dir(dir)
+{
+  boost::filesystem::create_directories(dir);
+
+  crypto_hash h;
+  unsigned version = GOTO_CONVERT_CACHE_VERSION;
+  h.ingest(&version, sizeof(version));
+  for (const char *opt : conversion_options)
+  {
+    hash_string(h, opt);
+    hash_string(h, options.get_option(opt));
+  }
+
+  unsigned target[] = {
+    config.ansi_c.word_size,
+    config.ansi_c.int_width,
+    config.ansi_c.long_int_width,
+    config.ansi_c.char_is_unsigned,
+    static_cast<unsigned>(config.ansi_c.endianess)};
+  h.ingest(target, sizeof(target));
+  h.fin();
+
+  salt = h.to_string();
+}
+
+std::string goto_convert_cachet::path(const std::string &key) const
+{
+  return (boost::filesystem::path(dir) / (key + ".goto")).string();
+}
+
+std::string
+goto_convert_cachet::key(const symbolt &symbol, const namespacet &ns) const
+{
+  crypto_hash h;
+  hash_string(h, salt);
+
+  irept irep;
+  symbol.to_irep(irep);
+  hash_irep(h, irep);
+
+  // The conversion also depends on the symbols referred to by the body, e.g.,
+  // whether a declared variable has static lifetime. Their values don't
+  // matter, but their types may refer to further symbols.
+  std::set<std::string> refs, done;
+  collect_identifiers(symbol.value, refs);
+  collect_identifiers(symbol.type, refs);
+  while (!refs.empty())
+  {
+    std::string id = *refs.begin();
+    refs.erase(refs.begin());
+    if (!done.insert(id).second)
+      continue;
+
+    hash_string(h, id);
+    const symbolt *s = ns.lookup(irep_idt(id));
+    if (!s)
+      continue;
+
+    symbolt tmp = *s;
+    tmp.value.make_nil();
+    tmp.to_irep(irep);
+    hash_irep(h, irep);
+
+    std::set<std::string> nested;
+    collect_identifiers(s->type, nested);
+    for (const auto &n : nested)
+      if (!done.count(n))
+        refs.insert(n);
+  }
+
+  h.fin();
+  return h.to_string();
+}
+
+bool goto_convert_cachet::load(
+  const std::string &key,
+  contextt &context,
+  goto_functiont &f)
+{
+  std::ifstream in(path(key), std::ios::in | std::ios::binary);
+  if (!in)
+  {
+    misses++;
+    return false;
+  }
+
+  char hdr[3];
+  in.read(hdr, sizeof(hdr));
+  if (
+    !in || hdr[0] != 'G' || hdr[1] != 'C' || hdr[2] != 'F' ||
+    irep_serializationt::read_long(in) != GOTO_CONVERT_CACHE_VERSION)
+  {
+    misses++;
+    return false;
+  }
+
+  irep_serializationt::ireps_containert ic;
+  irep_serializationt irepconverter(ic);
+  symbol_serializationt symbolconverter(ic);
+  goto_program_serializationt gpconverter(ic);
+
+  std::vector<symbolt> symbols(irepconverter.read_long(in));
+  for (symbolt &symbol : symbols)
+  {
+    irept t;
+    symbolconverter.convert(in, t);
+    symbol.from_irep(t);
+  }
+
+  irept body;
+  gpconverter.convert(in, body);
+  if (!in)
+  {
+    log_warning("goto-cache: ignoring truncated entry {}", path(key));
+    misses++;
+    return false;
+  }
+
+  for (const symbolt &symbol : symbols)
+  {
+    symbolt *s = context.find_symbol(symbol.id);
+    if (s)
+      *s = symbol;
+    else
+      context.add(symbol);
+  }
+
+  convert(body, f.body);
+  hits++;
+  return true;
+}
+
+void goto_convert_cachet::store(
+  const std::string &key,
+  const contextt &context,
+  const std::vector<irep_idt> &touched,
+  goto_functiont &f) const
+{
+  std::string dest = path(key);
+  std::string tmp =
+    dest + boost::filesystem::unique_path(".%%%%-%%%%.tmp").string();
+
+  {
+    std::ofstream out(tmp, std::ios::out | std::ios::binary);
+    if (!out)
+      return;
+
+    out << "GCF";
+    write_long(out, GOTO_CONVERT_CACHE_VERSION);
+
+    irep_serializationt::ireps_containert ic;
+    symbol_serializationt symbolconverter(ic);
+    goto_program_serializationt gpconverter(ic);
+
+    std::set<irep_idt> unique(touched.begin(), touched.end());
+    write_long(out, unique.size());
+    for (const irep_idt &id : unique)
+    {
+      const symbolt *s = context.find_symbol(id);
+      assert(s);
+      symbolconverter.convert(*s, out);
+    }
+
+    f.body.compute_location_numbers();
+    gpconverter.convert(f.body, out);
+
+    if (!out)
+    {
+      boost::filesystem::remove(tmp);
+      return;
+    }
+  }
+
+  boost::system::error_code ec;
+  boost::filesystem::rename(tmp, dest, ec);
+  if (ec)
+    boost::filesystem::remove(tmp, ec);
+}
@@ -0,0 +1,52 @@
+#ifndef CPROVER_GOTO_PROGRAMS_GOTO_CONVERT_CACHE_H
+#define CPROVER_GOTO_PROGRAMS_GOTO_CONVERT_CACHE_H
+
+#include <goto-programs/goto_functions.h>
+#include <util/context.h>
+#include <util/options.h>
+
+/**
+ * @brief On-disk cache of converted function bodies.
+ *
+ * Every function is keyed by a SHA-1 digest of its type-checked symbol (body
+ * and type), of the symbols its body refers to (without their values) and of
+ * the options that influence goto conversion. An entry holds the goto program
+ * of the function together with the symbols that its conversion created or
+ * modified in the context, so that a hit leaves the context and the function
+ * map exactly as converting the body would have.
+ *
+ * Entries are written to a temporary file first and then renamed, so several
+ * ESBMC processes can share the same cache directory.
+ */
+class goto_convert_cachet
+{
+public:
+  goto_convert_cachet(const std::string &dir, const optionst &options);
+
+  /// Compute the cache key for the function \p symbol.
+  std::string key(const symbolt &symbol, const namespacet &ns) const;
+
+  /// Try to restore the function stored under \p key into \p f, adding its
+  /// symbols to \p context. Returns true on a hit.
+  bool load(const std::string &key, contextt &context, goto_functiont &f);
+
+  /// Store the converted function \p f under \p key, along with the symbols
+  /// named in \p touched.
+  void store(
+    const std::string &key,
+    const contextt &context,
+    const std::vector<irep_idt> &touched,
+    goto_functiont &f) const;
+
+  unsigned hits = 0;
+  unsigned misses = 0;
+
+protected:
+  std::string dir;
+  // Digest prefix shared by all keys: format version and relevant options
+  std::string salt;
+
+  std::string path(const std::string &key) const;
+};
+
+#endif
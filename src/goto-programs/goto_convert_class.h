@@ -31,6 +31,10 @@ protected:
   namespacet ns;
   symbol_generator tmp_symbol;
 
+  // Ids of the symbols created or modified in the context while converting
+  // the current code, e.g. temporaries and rewritten VLA declarations.
+  std::vector<irep_idt> touched_symbols;
+
   void goto_convert_rec(const codet &code, goto_programt &dest);
 
   //
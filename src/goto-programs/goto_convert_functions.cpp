@@ -16,6 +16,9 @@ goto_convert_functionst::goto_convert_functionst(
   goto_functionst &_functions)
   : goto_convertt(_context, _options), functions(_functions)
 {
+  const std::string cache_dir = options.get_option("goto-cache");
+  if (!cache_dir.empty())
+    cache = std::make_unique<goto_convert_cachet>(cache_dir, options);
 }
 
 void goto_convert_functionst::goto_convert()
@@ -34,6 +37,10 @@ void goto_convert_functionst::goto_convert()
   }
 
   functions.compute_location_numbers();
+
+  if (cache)
+    log_status(
+      "GOTO conversion cache: {} hits, {} misses", cache->hits, cache->misses);
 }
 
 bool goto_convert_functionst::hide(const goto_programt &goto_program)
@@ -110,6 +117,16 @@ void goto_convert_functionst::convert_function(symbolt &symbol)
     abort();
   }
 
+  std::string cache_key;
+  if (cache)
+  {
+    cache_key = cache->key(symbol, ns);
+    if (cache->load(cache_key, context, f))
+      return;
+  }
+
+  touched_symbols.clear();
+
   const codet &code = to_code(symbol.value);
 
   locationt end_location;
@@ -173,6 +190,9 @@ void goto_convert_functionst::convert_function(symbolt &symbol)
 
   if (hide(f.body))
     f.body.hide = true;
+
+  if (cache)
+    cache->store(cache_key, context, touched_symbols, f);
 }
 
 void goto_convert(
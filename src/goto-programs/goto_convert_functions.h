@@ -1,8 +1,10 @@
 #ifndef CPROVER_GOTO_CONVERT_FUNCTIONS_H
 #define CPROVER_GOTO_CONVERT_FUNCTIONS_H
 
+#include <goto-programs/goto_convert_cache.h>
 #include <goto-programs/goto_convert_class.h>
 #include <goto-programs/goto_functions.h>
+#include <memory>
 
 // just convert it all
 void goto_convert(
@@ -35,6 +37,7 @@ public:
 
 protected:
   goto_functionst &functions;
+  std::unique_ptr<goto_convert_cachet> cache;
 
   static bool hide(const goto_programt &goto_program);
 
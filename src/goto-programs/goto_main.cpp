@@ -8,6 +8,7 @@ void goto_convertt::new_name(symbolt &symbol)
 
   // store in context
   context.add(symbol);
+  touched_symbols.push_back(symbol.id);
 }
 
 void goto_convert(
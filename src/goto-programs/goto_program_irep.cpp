@@ -93,6 +93,15 @@ void convert(const irept &irep, goto_programt &program)
 
   program.compute_location_numbers();
 
+  // Targets are stored as the location numbers the writer computed, which
+  // are the positions of the instructions; index them to resolve the links.
+  std::vector<goto_programt::targett> by_number;
+  by_number.reserve(program.instructions.size());
+  for (goto_programt::targett it = program.instructions.begin();
+       it != program.instructions.end();
+       it++)
+    by_number.push_back(it);
+
   // resolve targets
   std::list<std::list<unsigned>>::iterator nit = number_targets_list.begin();
   for (goto_programt::instructionst::iterator lit =
@@ -102,23 +111,15 @@ void convert(const irept &irep, goto_programt &program)
   {
     for (unsigned int &tit : *nit)
     {
-      goto_programt::targett fit = program.instructions.begin();
-      for (; fit != program.instructions.end(); fit++)
-      {
-        if (fit->location_number == tit)
-        {
-          lit->targets.push_back(fit);
-          break;
-        }
-      }
-
-      if (fit == program.instructions.end())
+      if (tit >= by_number.size())
       {
         log_error(
           "could not resolve target link during irep->goto_program "
           "translation.");
         abort();
       }
+
+      lit->targets.push_back(by_number[tit]);
     }
   }
 
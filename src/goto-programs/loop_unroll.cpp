@@ -165,3 +165,181 @@ int bounded_loop_unroller::get_loop_bounds(loopst &loop)
   number_of_bounded_loops++;
   return bound;
 }
+
+/// Adds to \symbols the symbols in \expr whose address is taken
+static void collect_address_taken(
+  const expr2tc &expr,
+  bool taken,
+  loopst::loop_varst &symbols)
+{
+  if (is_nil_expr(expr))
+    return;
+
+  if (taken && is_symbol2t(expr))
+    symbols.insert(expr);
+
+  taken = taken || is_address_of2t(expr);
+  expr->foreach_operand([taken, &symbols](const expr2tc &e) {
+    collect_address_taken(e, taken, symbols);
+  });
+}
+
+bool loop_accelerator::runOnFunction(
+  std::pair<const dstring, goto_functiont> &F)
+{
+  // Pointers to these locals could change them anywhere in the function
+  address_taken.clear();
+  for (const auto &instruction : F.second.body.instructions)
+  {
+    collect_address_taken(instruction.code, false, address_taken);
+    collect_address_taken(instruction.guard, false, address_taken);
+  }
+  return true;
+}
+
+bool loop_accelerator::is_loop_invariant(
+  const expr2tc &expr,
+  const loopst::loop_varst &modified) const
+{
+  // Memory could be changed by the loop through any pointer
+  if (is_dereference2t(expr) || is_address_of2t(expr))
+    return false;
+
+  bool res = true;
+  expr->foreach_operand([this, &modified, &res](const expr2tc &e) {
+    res = res && is_loop_invariant(e, modified);
+  });
+
+  if (!is_symbol2t(expr))
+    return res;
+
+  // Other threads could change globals between two iterations
+  const symbolt *s = context.find_symbol(to_symbol2t(expr).thename);
+  return res && s && !s->static_lifetime && !modified.count(expr) &&
+         !address_taken.count(expr);
+}
+
+bool loop_accelerator::runOnLoop(loopst &loop, goto_programt &goto_program)
+{
+  goto_programt::targett head = loop.get_original_loop_head();
+  goto_programt::targett loop_exit = loop.get_original_loop_exit();
+
+  // 1. The head should be IF !(counter < limit) THEN GOTO <after the loop>
+  if (
+    !head->is_goto() || !is_not2t(head->guard) ||
+    !is_true(loop_exit->guard) || head->get_target() != std::next(loop_exit))
+    return false;
+
+  const expr2tc &cond = to_not2t(head->guard).value;
+  if (!is_lessthan2t(cond))
+    return false;
+
+  const expr2tc &counter = to_lessthan2t(cond).side_1;
+  const expr2tc &limit = to_lessthan2t(cond).side_2;
+  if (
+    !is_symbol2t(counter) || !is_bv_type(counter) ||
+    counter->type->get_width() > 64 || limit->type != counter->type)
+    return false;
+
+  // 2. The body should only assign distinct local variables
+  loopst::loop_varst modified;
+  std::vector<goto_programt::targett> assignments;
+  for (goto_programt::targett t = std::next(head); t != loop_exit; t++)
+  {
+    if (t->is_skip() || t->is_location())
+      continue;
+
+    if (!t->is_assign())
+      return false;
+
+    const expr2tc &target = to_code_assign2t(t->code).target;
+    if (
+      !is_symbol2t(target) || !is_loop_invariant(target, {}) ||
+      !modified.insert(target).second)
+      return false;
+
+    assignments.push_back(t);
+  }
+
+  if (!modified.count(counter) || !is_loop_invariant(limit, modified))
+    return false;
+
+  // 3. Each assignment must be an increment by a constant or loop-invariant
+  for (const goto_programt::targett &t : assignments)
+  {
+    const code_assign2t &assign = to_code_assign2t(t->code);
+    const expr2tc &source = assign.source;
+
+    if (is_add2t(source) || is_sub2t(source))
+    {
+      const expr2tc &side_1 = *source->get_sub_expr(0);
+      const expr2tc &side_2 = *source->get_sub_expr(1);
+      if (side_1 == assign.target && is_constant_int2t(side_2))
+      {
+        // The counter must count up one by one
+        if (
+          assign.target == counter &&
+          (!is_add2t(source) || to_constant_int2t(side_2).value != 1))
+          return false;
+
+        // The number of iterations is converted to the type of the
+        // accumulator, which must be an integer at least as wide as the
+        // counter so that no iteration is lost
+        if (
+          assign.target != counter &&
+          (!is_bv_type(assign.target) ||
+           assign.target->type->get_width() < counter->type->get_width()))
+          return false;
+        continue;
+      }
+    }
+
+    if (assign.target == counter || !is_loop_invariant(source, modified))
+      return false;
+  }
+
+  // 4. Nothing else may jump into the loop body
+  std::unordered_set<const goto_programt::instructiont *> body;
+  for (goto_programt::targett t = std::next(head); t != std::next(loop_exit);
+       t++)
+    body.insert(&*t);
+
+  for (const auto &instruction : goto_program.instructions)
+    for (const auto &target : instruction.targets)
+      if (body.count(&*target))
+        return false;
+
+  // 5. Summarise: the head guarantees that the body runs limit - counter
+  //    times, which fits in 64 bits for any counter of up to 64 bits.
+  type2tc uint64 = get_uint64_type();
+  expr2tc iterations = sub2tc(
+    uint64, typecast2tc(uint64, limit), typecast2tc(uint64, counter));
+
+  for (const goto_programt::targett &t : assignments)
+  {
+    code_assign2t &assign = to_code_assign2t(t->code);
+    if (assign.target == counter)
+    {
+      t->make_skip();
+      continue;
+    }
+
+    // Invariant assignments keep their value from the first iteration on
+    if (!is_add2t(assign.source) && !is_sub2t(assign.source))
+      continue;
+
+    const type2tc &type = assign.target->type;
+    expr2tc total = mul2tc(
+      type, typecast2tc(type, iterations), *assign.source->get_sub_expr(1));
+    assign.source = is_add2t(assign.source)
+                      ? add2tc(type, assign.target, total)
+                      : sub2tc(type, assign.target, total);
+  }
+
+  // The backwards jump becomes the final value of the counter
+  loop_exit->make_assignment();
+  loop_exit->code = code_assign2tc(counter, limit);
+
+  number_of_accelerated_loops++;
+  return true;
+}
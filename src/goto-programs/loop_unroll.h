@@ -86,4 +86,67 @@ private:
   unsigned number_of_bounded_loops = 0;
 };
 
+/**
+ * @brief This replaces simple counting loops by their closed form, so that
+ * no unwinding is needed for them at all. It matches:
+ *
+ * 1: IF !(I < N) THEN GOTO 2
+ *    X = X + C  // or X = X - C
+ *    Y = E
+ *    I = I + 1
+ *    GOTO 1
+ * 2: Q
+ *
+ * where the body only has such assignments to distinct local variables
+ * whose address is never taken, X is an integer at least as wide as I, C is
+ * a constant and N and E only read such locals not assigned in the loop,
+ * never memory. Since I counts up to N one by one, the loop runs exactly
+ * N - I times, so it is converted into:
+ *
+ * 1: IF !(I < N) THEN GOTO 2
+ *    X = X + C * (N - I)
+ *    Y = E
+ *    I = N
+ * 2: Q
+ *
+ * Bit-vector arithmetic wraps the same way on every iteration, so the
+ * summary is exact. Loops with checks, calls or control flow in their body
+ * are left alone.
+ */
+class loop_accelerator : public goto_functions_algorithm
+{
+public:
+  explicit loop_accelerator(contextt &context)
+    : goto_functions_algorithm(true), context(context)
+  {
+  }
+
+  /**
+   * @brief Get the number of loops that were replaced after the
+   *        algorithm has run
+   *
+   * @return number of accelerated loops
+   */
+  unsigned get_number_of_accelerated_loops()
+  {
+    return number_of_accelerated_loops;
+  }
+
+protected:
+  contextt &context;
+  bool runOnFunction(std::pair<const dstring, goto_functiont> &F) override;
+  bool runOnLoop(loopst &loop, goto_programt &goto_program) override;
+
+  /// Whether \expr reads no memory and every symbol in it is a local
+  /// variable whose address is not taken and that is not in \modified
+  bool is_loop_invariant(
+    const expr2tc &expr,
+    const loopst::loop_varst &modified) const;
+
+private:
+  unsigned number_of_accelerated_loops = 0;
+  /// Locals of the current function whose address is taken
+  loopst::loop_varst address_taken;
+};
+
 #endif
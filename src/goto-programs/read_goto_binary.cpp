@@ -1,18 +1,81 @@
+#include <goto-programs/goto_binary_index.h>
 #include <goto-programs/read_bin_goto_object.h>
 #include <goto-programs/read_goto_binary.h>
-#include <fstream>
 #include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
 #include <boost/iostreams/stream.hpp>
+#include <cstring>
 
-bool read_goto_binary_array(
+static bool is_indexed_goto_binary(const void *data, size_t size)
+{
+  const unsigned char *p = static_cast<const unsigned char *>(data);
+  if (size < 7 || memcmp(p, "GBF", 3) != 0)
+    return false;
+
+  unsigned version = (p[3] << 24) | (p[4] << 16) | (p[5] << 8) | p[6];
+  return version == GOTO_BINARY_INDEX_VERSION;
+}
+
+bool read_goto_binary_index(
+  goto_binary_indext &index,
+  contextt &context,
+  goto_functionst &dest)
+{
+  for (unsigned i = 0; i < index.symbol_count(); i++)
+  {
+    symbolt symbol;
+    index.read_symbol(i, symbol);
+
+    if (!symbol.is_type && symbol.type.is_code())
+    {
+      // makes sure there is an empty function for every function symbol and
+      // fixes the function types, as read_bin_goto_object() does
+      goto_functiont &f = dest.function_map[symbol.id];
+      f.type = to_code_type(symbol.type);
+    }
+    context.add(symbol);
+  }
+
+  for (unsigned i = 0; i < index.function_count(); i++)
+  {
+    goto_functiont &f = dest.function_map[index.function_name(i)];
+    index.read_function(i, f.body);
+    f.body_available = f.body.instructions.size() > 0;
+  }
+
+  return false;
+}
+
+static bool read_goto_binary_data(
   const void *data,
   size_t size,
+  const std::string &filename,
   contextt &context,
   goto_functionst &dest)
 {
+  if (is_indexed_goto_binary(data, size))
+  {
+    goto_binary_indext index;
+    if (index.open(data, size))
+    {
+      log_error("`{}' is a malformed goto-binary", filename);
+      return true;
+    }
+    return read_goto_binary_index(index, context, dest);
+  }
+
   using namespace boost::iostreams;
   stream<array_source> src(static_cast<const char *>(data), size);
-  return read_bin_goto_object(src, "", context, dest);
+  return read_bin_goto_object(src, filename, context, dest);
+}
+
+bool read_goto_binary_array(
+  const void *data,
+  size_t size,
+  contextt &context,
+  goto_functionst &dest)
+{
+  return read_goto_binary_data(data, size, "", context, dest);
 }
 
 bool read_goto_binary(
@@ -20,6 +83,24 @@ bool read_goto_binary(
   contextt &context,
   goto_functionst &dest)
 {
-  std::ifstream in(path, std::ios::in | std::ios::binary);
-  return read_bin_goto_object(in, path, context, dest);
+  // Map the file rather than streaming it: indexed binaries are then parsed
+  // in place and only the pages holding records actually read are loaded.
+  boost::iostreams::mapped_file_source file;
+  try
+  {
+    file.open(path);
+  }
+  catch (const std::exception &e)
+  {
+    log_error("Failed to open goto-binary `{}': {}", path, e.what());
+    return true;
+  }
+
+  if (!file.is_open())
+  {
+    log_error("Failed to open goto-binary `{}'", path);
+    return true;
+  }
+
+  return read_goto_binary_data(file.data(), file.size(), path, context, dest);
 }
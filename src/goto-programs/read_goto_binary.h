@@ -1,11 +1,20 @@
 #ifndef CPROVER_GOTO_PROGRAMS_READ_GOTO_BINARY_H
 #define CPROVER_GOTO_PROGRAMS_READ_GOTO_BINARY_H
 
+#include <goto-programs/goto_binary_index.h>
 #include <goto-programs/goto_functions.h>
 #include <util/context.h>
 #include <util/message.h>
 #include <util/options.h>
 
+/// Add all symbols and function bodies of an opened indexed goto binary.
+bool read_goto_binary_index(
+  goto_binary_indext &index,
+  contextt &context,
+  goto_functionst &dest);
+
+/// Read a goto binary held in memory, either indexed or in the stream format
+/// written by write_goto_binary(). Returns true on error.
 bool read_goto_binary_array(
   const void *data,
   size_t size,
@@ -1,6 +1,8 @@
 #include <cassert>
 #include <goto-symex/build_goto_trace.h>
 #include <goto-symex/witnesses.h>
+#include <unordered_set>
+#include <util/perf_report.h>
 
 expr2tc build_lhs(smt_convt &smt_conv, const expr2tc &lhs)
 {
@@ -49,18 +51,92 @@ expr2tc build_rhs(smt_convt &smt_conv, const expr2tc &rhs)
   return new_rhs;
 }
 
+/* Collect the scalar symbols in expr, whose values get() will look up by
+ * converting them to asts. */
+static void collect_model_symbols(
+  const expr2tc &expr,
+  std::unordered_set<expr2tc, irep2_hash> &symbols)
+{
+  if (is_nil_expr(expr) || is_constant_expr(expr))
+    return;
+
+  if (is_symbol2t(expr))
+  {
+    if (
+      (is_bool_type(expr) || is_bv_type(expr) || is_fixedbv_type(expr)) &&
+      to_symbol2t(expr).thename != "NULL")
+      symbols.insert(expr);
+    return;
+  }
+
+  expr->foreach_operand(
+    [&symbols](const expr2tc &e) { collect_model_symbols(e, symbols); });
+}
+
+/* Fetch the values that building the trace will need in bulk, instead of
+ * querying the solver one step at a time: first the guards and conditions of
+ * all steps, then the symbols shown by the steps that were taken. */
+static void fetch_trace_values(
+  const std::vector<const symex_target_equationt::SSA_stept *> &steps,
+  smt_convt &smt_conv)
+{
+  std::vector<smt_astt> asts;
+  for (const auto *step : steps)
+  {
+    asts.push_back(step->guard_ast);
+    if (step->is_assert() || step->is_assume())
+      asts.push_back(step->cond_ast);
+  }
+  smt_conv.fetch_values(asts);
+
+  std::unordered_set<expr2tc, irep2_hash> symbols;
+  for (const auto *step : steps)
+  {
+    if (!smt_conv.l_get(step->guard_ast).is_true())
+      continue;
+
+    if (step->is_assignment())
+    {
+      for (expr2tc lhs = step->original_lhs; is_index2t(lhs);
+           lhs = to_index2t(lhs).source_value)
+        collect_model_symbols(to_index2t(lhs).index, symbols);
+
+      collect_model_symbols(
+        is_nil_expr(step->original_rhs) ? step->rhs : step->original_rhs,
+        symbols);
+    }
+
+    if (step->is_output())
+      for (const auto &arg : step->converted_output_args)
+        collect_model_symbols(arg, symbols);
+  }
+
+  asts.clear();
+  for (const expr2tc &sym : symbols)
+    asts.push_back(smt_conv.convert_ast(sym));
+  smt_conv.fetch_values(asts);
+}
+
 void build_goto_trace(
   const symex_target_equationt &target,
   smt_convt &smt_conv,
   goto_tracet &goto_trace,
   const bool &is_compact_trace)
 {
+  perf_phaset phase("trace");
+  std::vector<const symex_target_equationt::SSA_stept *> steps;
+  for (auto const &SSA_step : target.SSA_steps)
+    if (!(SSA_step.hidden && is_compact_trace))
+      steps.push_back(&SSA_step);
+
+  if (smt_conv.supports_batch_fetch())
+    fetch_trace_values(steps, smt_conv);
+
   unsigned step_nr = 0;
 
-  for (auto const &SSA_step : target.SSA_steps)
+  for (const auto *step : steps)
   {
-    if (SSA_step.hidden && is_compact_trace)
-      continue;
+    auto const &SSA_step = *step;
 
     if (!smt_conv.l_get(SSA_step.guard_ast).is_true())
       continue;
@@ -21,6 +21,7 @@
 #include <util/migrate.h>
 #include <util/prefix.h>
 #include <util/std_types.h>
+#include <util/type_byte_size.h>
 #include <vector>
 #include <algorithm>
 #include <util/array2string.h>
@@ -105,6 +106,70 @@ void goto_symext::symex_realloc(const expr2tc &lhs, const sideeffect2t &code)
   symex_assign(code_assign2tc(lhs, result), true);
 }
 
+/** Whether objects of the given type hold pointers, or may hold them */
+static bool may_hold_pointers(const type2tc &type)
+{
+  if (is_array_type(type))
+    return may_hold_pointers(to_array_type(type).subtype);
+
+  if (is_vector_type(type))
+    return may_hold_pointers(to_vector_type(type).subtype);
+
+  if (is_struct_type(type) || is_union_type(type))
+  {
+    const struct_union_data &data =
+      static_cast<const struct_union_data &>(*type.get());
+    return std::any_of(
+      data.members.begin(), data.members.end(), may_hold_pointers);
+  }
+
+  // Symbol types are not followed here
+  return is_pointer_type(type) || is_symbol_type(type) || is_code_type(type);
+}
+
+/* Adds to `types` the pointee types of the pointer conversions in `expr`
+ * between two different types that are not void */
+static void collect_punned_types(
+  const expr2tc &expr,
+  const namespacet &ns,
+  std::unordered_set<type2tc, type2_hash> &types)
+{
+  if (is_nil_expr(expr))
+    return;
+
+  if (
+    is_typecast2t(expr) && is_pointer_type(expr) &&
+    is_pointer_type(to_typecast2t(expr).from))
+  {
+    type2tc to = ns.follow(to_pointer_type(expr->type).subtype);
+    type2tc from =
+      ns.follow(to_pointer_type(to_typecast2t(expr).from->type).subtype);
+    if (!is_empty_type(to) && !is_empty_type(from) && to != from)
+    {
+      types.insert(to);
+      types.insert(from);
+    }
+  }
+
+  expr->foreach_operand([&ns, &types](const expr2tc &e) {
+    collect_punned_types(e, ns, types);
+  });
+}
+
+std::unordered_set<type2tc, type2_hash> goto_symext::collect_punned_types(
+  const goto_functionst &goto_functions,
+  const namespacet &ns)
+{
+  std::unordered_set<type2tc, type2_hash> types;
+  forall_goto_functions (it, goto_functions)
+    forall_goto_program_instructions (i, it->second.body)
+    {
+      ::collect_punned_types(i->code, ns, types);
+      ::collect_punned_types(i->guard, ns, types);
+    }
+  return types;
+}
+
 expr2tc goto_symext::symex_mem(
   const bool is_malloc,
   const expr2tc &lhs,
@@ -137,6 +202,29 @@ expr2tc goto_symext::symex_mem(
     }
   }
 
+  // In the byte-array memory model, an object the program also accesses as
+  // another type is an array of its bytes, so that the solver reads and
+  // writes it with array selects and stores rather than by extracting bytes
+  // out of typed values. Every access wider than a byte then reads or writes
+  // each of its bytes, so objects only accessed as their own type keep typed
+  // storage, which is the fast path for them. Pointers stored in memory are
+  // tracked by the value set per field, so objects that may hold them keep
+  // their type as well.
+  if (
+    punned_types && !is_byte_type(type) && !may_hold_pointers(type) &&
+    punned_types->count(ns.follow(type)))
+  {
+    expr2tc bytes = type_byte_size_expr(type, &ns);
+    if (!size_is_one)
+      bytes = mul2tc(bytes->type, bytes, typecast2tc(bytes->type, size));
+    simplify(bytes);
+
+    type = get_uint8_type();
+    size = bytes;
+    size_is_one =
+      is_constant_int2t(size) && to_constant_int2t(size).value == 1;
+  }
+
   unsigned int &dynamic_counter = get_dynamic_counter();
   dynamic_counter++;
 
@@ -1271,6 +1359,93 @@ static inline expr2tc gen_value_by_byte(
   return gen_byte_expression(type, src, value, num_of_bytes, offset);
 }
 
+/* Symbolic-size operations are encoded for each element of the object up to
+ * its end, so only objects of up to this many elements are summarised. */
+static const uint64_t max_bounded_elements = 1 << 12;
+
+/* Whether `num_of_bytes` is known to be a whole number of elements of
+ * `elem_size` bytes. Beyond single bytes this is only recognised for the
+ * usual `count * sizeof(T)`, with a power of two as the element size so that
+ * wrapping around preserves it. */
+static bool is_whole_elements(expr2tc num_of_bytes, uint64_t elem_size)
+{
+  if (elem_size == 1)
+    return true;
+
+  if (elem_size & (elem_size - 1))
+    return false;
+
+  while (
+    is_typecast2t(num_of_bytes) && is_bv_type(num_of_bytes) &&
+    is_bv_type(to_typecast2t(num_of_bytes).from))
+    num_of_bytes = to_typecast2t(num_of_bytes).from;
+
+  if (!is_mul2t(num_of_bytes))
+    return false;
+
+  for (const expr2tc &factor :
+       {to_mul2t(num_of_bytes).side_1, to_mul2t(num_of_bytes).side_2})
+    if (
+      is_constant_int2t(factor) &&
+      to_constant_int2t(factor).value % elem_size == 0)
+      return true;
+
+  return false;
+}
+
+/**
+ * @brief Computes the value of the array `dst` after the region starting at
+ * byte `offset` was overwritten with `num_of_bytes` bytes, when that number
+ * is symbolic but at most `max_bytes`.
+ *
+ * Each element `i` of the region becomes
+ * `(i + 1) * sizeof(element) <= num_of_bytes ? new_element(i) : dst[i]`.
+ *
+ * Returns nil if the region is not made of whole elements, is too large or
+ * `new_element` returns nil; callers should fall back to the library
+ * implementation.
+ */
+template <typename F>
+static expr2tc gen_bounded_update(
+  const expr2tc &dst,
+  uint64_t offset,
+  const expr2tc &num_of_bytes,
+  uint64_t max_bytes,
+  F &&new_element)
+{
+  if (!is_array_type(dst))
+    return expr2tc();
+
+  const type2tc &subtype = to_array_type(dst->type).subtype;
+  uint64_t elem_size = type_byte_size(subtype).to_uint64();
+  if (
+    elem_size == 0 || offset % elem_size ||
+    !is_whole_elements(num_of_bytes, elem_size) ||
+    max_bytes / elem_size > max_bounded_elements)
+    return expr2tc();
+
+  type2tc uint64 = get_uint64_type();
+  expr2tc n = typecast2tc(uint64, num_of_bytes);
+  expr2tc result = dst;
+  for (uint64_t i = 0; i < max_bytes / elem_size; i++)
+  {
+    expr2tc value = new_element(i);
+    if (!value)
+      return expr2tc();
+
+    expr2tc idx = constant_int2tc(uint64, BigInt(offset / elem_size + i));
+    expr2tc in_region =
+      lessthanequal2tc(constant_int2tc(uint64, BigInt((i + 1) * elem_size)), n);
+    result = with2tc(
+      dst->type,
+      result,
+      idx,
+      if2tc(subtype, in_region, value, index2tc(subtype, dst, idx)));
+  }
+
+  return result;
+}
+
 /**
  * @brief This function will try to initialize the object pointed by
  * the address in a smarter way, minimizing the number of assignments.
@@ -1334,12 +1509,11 @@ void goto_symext::intrinsic_memset(
   /* Preconditions for the optimization:
    * A: It should point to someplace
    * B: byte itself should be renamed properly
-   * C: Number of bytes cannot be symbolic
-   * D: This is a simplification. So don't run with --no-simplify */
+   * C: This is a simplification. So don't run with --no-simplify */
   cur_state->rename(arg1);
   cur_state->rename(arg2);
   if (
-    !internal_deref_items.size() || !arg1 || !arg2 || is_symbol2t(arg2) ||
+    !internal_deref_items.size() || !arg1 || !arg2 ||
     options.get_bool_option("no-simplify"))
   {
     /* Not sure what to do here, let's rely
@@ -1349,15 +1523,12 @@ void goto_symext::intrinsic_memset(
     return;
   }
 
+  /* A symbolic number of bytes is set up to the end of the object, each
+   * element only if it lies within that number, see gen_bounded_update */
   simplify(arg2);
-  if (!is_constant_int2t(arg2))
-  {
-    log_debug("memset", "TODO: simplifier issues :/");
-    bump_call(func_call, "c:@F@__memset_impl");
-    return;
-  }
-
-  unsigned long number_of_bytes = to_constant_int2t(arg2).as_ulong();
+  bool symbolic_size = !is_constant_int2t(arg2);
+  unsigned long number_of_bytes =
+    symbolic_size ? 0 : to_constant_int2t(arg2).as_ulong();
 
   // Where are we pointing to?
   for (auto &item : internal_deref_items)
@@ -1457,6 +1628,48 @@ void goto_symext::intrinsic_memset(
       continue;
     }
 
+    if (symbolic_size)
+    {
+      uint64_t room =
+        number_of_offset > type_size ? 0 : type_size - number_of_offset;
+      expr2tc new_object = gen_bounded_update(
+        item_object, number_of_offset, arg2, room, [&](uint64_t i) {
+          const type2tc &subtype = to_array_type(item_object->type).subtype;
+          uint64_t elem_size = type_byte_size(subtype).to_uint64();
+          expr2tc idx = constant_int2tc(
+            get_uint64_type(), BigInt(number_of_offset / elem_size + i));
+          return gen_value_by_byte(
+            subtype, index2tc(subtype, item_object, idx), arg1, elem_size, 0);
+        });
+      if (!new_object)
+      {
+        log_debug("memset", "Couldn't summarise a memset of symbolic size");
+        bump_call(func_call, "c:@F@__memset_impl");
+        return;
+      }
+
+      if (
+        !options.get_bool_option("no-pointer-check") &&
+        !options.get_bool_option("no-bounds-check"))
+      {
+        // SAME_OBJECT(ptr, item) => n <= room
+        expr2tc check = implies2tc(
+          item.guard,
+          lessthanequal2tc(
+            typecast2tc(get_uint64_type(), arg2),
+            constant_int2tc(get_uint64_type(), BigInt(room))));
+        claim(
+          check,
+          fmt::format(
+            "dereference failure: memset beyond the {} bytes left in an "
+            "object",
+            room));
+      }
+
+      symex_assign(code_assign2tc(item.object, new_object), false, guard);
+      continue;
+    }
+
     bool is_out_bounds = ((type_size - number_of_offset) < number_of_bytes) ||
                          (number_of_offset > type_size);
     if (
@@ -1503,6 +1716,431 @@ void goto_symext::intrinsic_memset(
   symex_assign(code_assign2tc(ret_ref, arg0), false, cur_state->guard);
 }
 
+/* Byte offset of a dereferenced item, if it is known during symex. */
+static bool get_constant_offset(expr2tc offset, uint64_t &result)
+{
+  simplify(offset);
+
+  // Same missing simplification as in intrinsic_memset
+  if (is_div2t(offset) && is_mul2t(to_div2t(offset).side_1))
+  {
+    const div2t &as_div = to_div2t(offset);
+    const mul2t &as_mul = to_mul2t(as_div.side_1);
+    if (
+      is_pointer_offset2t(as_mul.side_1) && is_constant_int2t(as_mul.side_2) &&
+      is_constant_int2t(as_div.side_2) &&
+      to_constant_int2t(as_mul.side_2).value ==
+        to_constant_int2t(as_div.side_2).value)
+      offset = gen_zero(get_uint64_type());
+  }
+
+  if (!is_constant_int2t(offset))
+    return false;
+
+  result = to_constant_int2t(offset).value.to_uint64();
+  return true;
+}
+
+/* Objects are copied element by element: arrays through their subtype and
+ * anything else as a single element. */
+static const type2tc &copy_element_type(const expr2tc &object)
+{
+  return is_array_type(object) ? to_array_type(object->type).subtype
+                               : object->type;
+}
+
+/**
+ * @brief Computes the value of `dst` after `num_of_bytes` bytes, starting at
+ * `src_offset` in `src`, were copied into it starting at `dst_offset`.
+ *
+ * The copy is encoded at the array level: a whole object is assigned
+ * directly and array regions become a chain of `with` updates, one per
+ * element, reading the source from before the copy. This is what memmove
+ * requires, so overlapping regions need no special treatment.
+ *
+ * Returns nil if the element types are not compatible or the region is not
+ * element-aligned; callers should fall back to the library implementation.
+ */
+static expr2tc gen_value_by_copy(
+  const expr2tc &dst,
+  uint64_t dst_offset,
+  const expr2tc &src,
+  uint64_t src_offset,
+  uint64_t num_of_bytes)
+{
+  if (num_of_bytes == 0)
+    return dst;
+
+  if (
+    dst_offset == 0 && src_offset == 0 && dst->type == src->type &&
+    type_byte_size(dst->type).to_uint64() == num_of_bytes)
+    return src;
+
+  const type2tc &dst_subtype = copy_element_type(dst);
+  const type2tc &src_subtype = copy_element_type(src);
+
+  // Integers of the same width have the same representation
+  bool same_width_ints = is_bv_type(dst_subtype) && is_bv_type(src_subtype) &&
+                         dst_subtype->get_width() == src_subtype->get_width();
+  if (dst_subtype != src_subtype && !same_width_ints)
+    return expr2tc();
+
+  uint64_t elem_size = type_byte_size(dst_subtype).to_uint64();
+  if (
+    elem_size == 0 || dst_offset % elem_size || src_offset % elem_size ||
+    num_of_bytes % elem_size)
+    return expr2tc();
+
+  expr2tc result = dst;
+  for (uint64_t i = 0; i < num_of_bytes / elem_size; i++)
+  {
+    expr2tc src_idx =
+      constant_int2tc(get_uint64_type(), BigInt(src_offset / elem_size + i));
+    expr2tc dst_idx =
+      constant_int2tc(get_uint64_type(), BigInt(dst_offset / elem_size + i));
+
+    expr2tc value =
+      is_array_type(src) ? index2tc(src_subtype, src, src_idx) : src;
+    if (src_subtype != dst_subtype)
+      value = typecast2tc(dst_subtype, value);
+
+    result = is_array_type(dst)
+               ? with2tc(dst->type, result, dst_idx, value)
+               : value;
+  }
+
+  return result;
+}
+
+/* Same as gen_value_by_copy, for a symbolic number of bytes of at most
+ * `max_bytes`. */
+static expr2tc gen_value_by_bounded_copy(
+  const expr2tc &dst,
+  uint64_t dst_offset,
+  const expr2tc &src,
+  uint64_t src_offset,
+  const expr2tc &num_of_bytes,
+  uint64_t max_bytes)
+{
+  if (!is_array_type(dst) || !is_array_type(src))
+    return expr2tc();
+
+  const type2tc &dst_subtype = to_array_type(dst->type).subtype;
+  const type2tc &src_subtype = to_array_type(src->type).subtype;
+  bool same_width_ints = is_bv_type(dst_subtype) && is_bv_type(src_subtype) &&
+                         dst_subtype->get_width() == src_subtype->get_width();
+  if (dst_subtype != src_subtype && !same_width_ints)
+    return expr2tc();
+
+  uint64_t elem_size = type_byte_size(src_subtype).to_uint64();
+  if (elem_size == 0 || src_offset % elem_size)
+    return expr2tc();
+
+  return gen_bounded_update(
+    dst, dst_offset, num_of_bytes, max_bytes, [&](uint64_t i) -> expr2tc {
+      expr2tc idx = constant_int2tc(
+        get_uint64_type(), BigInt(src_offset / elem_size + i));
+      expr2tc value = index2tc(src_subtype, src, idx);
+      return src_subtype == dst_subtype ? value
+                                        : typecast2tc(dst_subtype, value);
+    });
+}
+
+void goto_symext::intrinsic_memcpy(
+  reachability_treet &art,
+  const code_function_call2t &func_call,
+  const std::string &impl)
+{
+  assert(func_call.operands.size() == 3 && "Wrong memcpy signature");
+  const execution_statet &ex_state = art.get_cur_state();
+  if (ex_state.cur_state->guard.is_false())
+    return;
+
+  /* Get the arguments
+   * arg0: ptr to the destination object
+   * arg1: ptr to the source object
+   * arg2: number of bytes to be copied */
+  expr2tc arg0 = func_call.operands[0];
+  expr2tc arg1 = func_call.operands[1];
+  expr2tc arg2 = func_call.operands[2];
+
+  cur_state->rename(arg2);
+  simplify(arg2);
+  if (!arg2 || options.get_bool_option("no-simplify"))
+  {
+    log_debug("memcpy", "Couldn't optimize memcpy due to precondition");
+    bump_call(func_call, impl);
+    return;
+  }
+
+  /* A symbolic number of bytes is copied up to the end of the objects, each
+   * element only if it lies within that number, see gen_bounded_update */
+  bool symbolic_size = !is_constant_int2t(arg2);
+  uint64_t number_of_bytes =
+    symbolic_size ? 0 : to_constant_int2t(arg2).value.to_uint64();
+
+  internal_deref_items.clear();
+  expr2tc deref = dereference2tc(get_empty_type(), arg1);
+  dereference(deref, dereferencet::INTERNAL);
+  std::list<dereference_callbackt::internal_item> src_items;
+  src_items.swap(internal_deref_items);
+
+  deref = dereference2tc(get_empty_type(), arg0);
+  dereference(deref, dereferencet::INTERNAL);
+  std::list<dereference_callbackt::internal_item> dst_items;
+  dst_items.swap(internal_deref_items);
+
+  // Reading from several objects would need a case split per source
+  if (src_items.size() != 1 || dst_items.empty())
+  {
+    log_debug("memcpy", "Source or destination object is not unique");
+    bump_call(func_call, impl);
+    return;
+  }
+
+  /* Anything that isn't a plain in-bounds copy goes through the library
+   * implementation, which reports the precise failure. Nothing is assigned
+   * until every destination has been encoded, so we can still bail out. */
+  auto object_size = [](const expr2tc &object, uint64_t &size) {
+    try
+    {
+      size = type_byte_size(object->type).to_uint64();
+    }
+    catch (const array_type2t::dyn_sized_array_excp &)
+    {
+      return false;
+    }
+    return true;
+  };
+
+  expr2tc src_object = src_items.front().object;
+  expr2tc src_offset = src_items.front().offset;
+  cur_state->rename(src_object);
+  cur_state->rename(src_offset);
+
+  uint64_t src_off, src_size;
+  if (
+    !src_object || !src_offset || is_code_type(src_object->type) ||
+    !get_constant_offset(src_offset, src_off) ||
+    !object_size(src_object, src_size) || src_off > src_size ||
+    (!symbolic_size && src_size - src_off < number_of_bytes))
+  {
+    log_debug("memcpy", "Couldn't encode the source object");
+    bump_call(func_call, impl);
+    return;
+  }
+
+  std::vector<std::pair<expr2tc, expr2tc>> assignments;
+  std::vector<guardt> guards;
+  // The room each copy has, which a symbolic size must not exceed
+  std::vector<std::pair<expr2tc, uint64_t>> bounds;
+  for (const auto &item : dst_items)
+  {
+    expr2tc item_object = item.object;
+    expr2tc item_offset = item.offset;
+    cur_state->rename(item_object);
+    cur_state->rename(item_offset);
+
+    uint64_t dst_off, dst_size;
+    if (
+      !item_object || !item_offset || is_code_type(item_object->type) ||
+      !get_constant_offset(item_offset, dst_off) ||
+      !object_size(item_object, dst_size) || dst_off > dst_size ||
+      (!symbolic_size && dst_size - dst_off < number_of_bytes))
+    {
+      log_debug("memcpy", "Couldn't encode a destination object");
+      bump_call(func_call, impl);
+      return;
+    }
+
+    uint64_t room = std::min(dst_size - dst_off, src_size - src_off);
+    expr2tc new_object =
+      symbolic_size
+        ? gen_value_by_bounded_copy(
+            item_object, dst_off, src_object, src_off, arg2, room)
+        : gen_value_by_copy(
+            item_object, dst_off, src_object, src_off, number_of_bytes);
+    if (!new_object)
+    {
+      log_debug("memcpy", "gen_value_by_copy failed");
+      bump_call(func_call, impl);
+      return;
+    }
+
+    guardt guard = ex_state.cur_state->guard;
+    guard.add(item.guard);
+    guard.add(src_items.front().guard);
+    assignments.emplace_back(item.object, new_object);
+    guards.push_back(guard);
+    bounds.emplace_back(and2tc(item.guard, src_items.front().guard), room);
+  }
+
+  if (
+    symbolic_size && !options.get_bool_option("no-pointer-check") &&
+    !options.get_bool_option("no-bounds-check"))
+  {
+    for (const auto &[same_objects, room] : bounds)
+    {
+      // SAME_OBJECT(dst, item) && SAME_OBJECT(src, item) => n <= room
+      expr2tc check = implies2tc(
+        same_objects,
+        lessthanequal2tc(
+          typecast2tc(get_uint64_type(), arg2),
+          constant_int2tc(get_uint64_type(), BigInt(room))));
+      claim(
+        check,
+        fmt::format(
+          "dereference failure: memcpy beyond the {} bytes left in an object",
+          room));
+    }
+  }
+
+  for (size_t i = 0; i < assignments.size(); i++)
+    symex_assign(
+      code_assign2tc(assignments[i].first, assignments[i].second),
+      false,
+      guards[i]);
+
+  // Lastly, let's add NULL ptr checks
+  if (!options.get_bool_option("no-pointer-check"))
+  {
+    for (const expr2tc &ptr : {arg0, arg1})
+    {
+      expr2tc null_sym = symbol2tc(ptr->type, "NULL");
+      expr2tc null_check = not2tc(same_object2tc(ptr, null_sym));
+      ex_state.cur_state->guard.guard_expr(null_check);
+      claim(null_check, " dereference failure: NULL pointer");
+    }
+  }
+
+  expr2tc ret_ref = func_call.ret;
+  dereference(ret_ref, dereferencet::READ);
+  symex_assign(code_assign2tc(ret_ref, arg0), false, cur_state->guard);
+}
+
+void goto_symext::intrinsic_memcmp(
+  reachability_treet &art,
+  const code_function_call2t &func_call)
+{
+  assert(func_call.operands.size() == 3 && "Wrong memcmp signature");
+  const execution_statet &ex_state = art.get_cur_state();
+  if (ex_state.cur_state->guard.is_false())
+    return;
+
+  /* Get the arguments
+   * arg0: ptr to the first object
+   * arg1: ptr to the second object
+   * arg2: number of bytes to be compared */
+  expr2tc arg0 = func_call.operands[0];
+  expr2tc arg1 = func_call.operands[1];
+  expr2tc arg2 = func_call.operands[2];
+
+  cur_state->rename(arg2);
+  simplify(arg2);
+  if (
+    !is_constant_int2t(arg2) || options.get_bool_option("no-simplify") ||
+    to_constant_int2t(arg2).value > max_bounded_elements)
+  {
+    log_debug("memcmp", "Couldn't optimize memcmp due to precondition");
+    bump_call(func_call, "c:@F@__memcmp_impl");
+    return;
+  }
+
+  uint64_t number_of_bytes = to_constant_int2t(arg2).value.to_uint64();
+
+  // Both sides must be a single object with the bytes at a known offset
+  expr2tc objects[2];
+  uint64_t offsets[2];
+  expr2tc same_objects = gen_true_expr();
+  for (int i = 0; i < 2; i++)
+  {
+    internal_deref_items.clear();
+    expr2tc deref = dereference2tc(get_empty_type(), i ? arg1 : arg0);
+    dereference(deref, dereferencet::INTERNAL);
+    if (internal_deref_items.size() != 1)
+    {
+      log_debug("memcmp", "Object is not unique");
+      bump_call(func_call, "c:@F@__memcmp_impl");
+      return;
+    }
+
+    const auto &item = internal_deref_items.front();
+    objects[i] = item.object;
+    expr2tc offset = item.offset;
+    cur_state->rename(objects[i]);
+    cur_state->rename(offset);
+
+    uint64_t size;
+    if (
+      !objects[i] || !offset || is_code_type(objects[i]->type) ||
+      !get_constant_offset(offset, offsets[i]))
+    {
+      log_debug("memcmp", "Couldn't encode an object");
+      bump_call(func_call, "c:@F@__memcmp_impl");
+      return;
+    }
+
+    try
+    {
+      size = type_byte_size(objects[i]->type).to_uint64();
+    }
+    catch (const array_type2t::dyn_sized_array_excp &)
+    {
+      bump_call(func_call, "c:@F@__memcmp_impl");
+      return;
+    }
+
+    // The library implementation reports out-of-bounds reads
+    if (offsets[i] > size || size - offsets[i] < number_of_bytes)
+    {
+      log_debug("memcmp", "Comparison is out of bounds");
+      bump_call(func_call, "c:@F@__memcmp_impl");
+      return;
+    }
+
+    same_objects = and2tc(same_objects, item.guard);
+  }
+  internal_deref_items.clear();
+
+  /* The result is the difference of the first pair of bytes that differ, as
+   * unsigned chars, so it is built from the last byte to the first */
+  bool is_big_endian =
+    (config.ansi_c.endianess == configt::ansi_ct::IS_BIG_ENDIAN);
+  const type2tc &int_type = func_call.ret->type;
+  expr2tc result = gen_zero(int_type);
+  for (uint64_t i = number_of_bytes; i-- > 0;)
+  {
+    expr2tc bytes[2];
+    for (int j = 0; j < 2; j++)
+      bytes[j] = byte_extract2tc(
+        get_uint8_type(), objects[j], gen_ulong(offsets[j] + i), is_big_endian);
+
+    expr2tc diff = sub2tc(
+      int_type,
+      typecast2tc(int_type, bytes[0]),
+      typecast2tc(int_type, bytes[1]));
+    result = if2tc(int_type, notequal2tc(bytes[0], bytes[1]), diff, result);
+  }
+
+  // Lastly, let's add NULL ptr checks
+  if (!options.get_bool_option("no-pointer-check"))
+  {
+    for (const expr2tc &ptr : {arg0, arg1})
+    {
+      expr2tc null_sym = symbol2tc(ptr->type, "NULL");
+      expr2tc null_check = not2tc(same_object2tc(ptr, null_sym));
+      ex_state.cur_state->guard.guard_expr(null_check);
+      claim(null_check, " dereference failure: NULL pointer");
+    }
+  }
+
+  guardt guard = ex_state.cur_state->guard;
+  guard.add(same_objects);
+  expr2tc ret_ref = func_call.ret;
+  dereference(ret_ref, dereferencet::READ);
+  symex_assign(code_assign2tc(ret_ref, result), false, guard);
+}
+
 void goto_symext::intrinsic_get_object_size(
   const code_function_call2t &func_call,
   reachability_treet &)
@@ -647,11 +647,9 @@ bool execution_statet::is_cur_state_guard_false(const expr2tc &guard)
     runtime_encoded_equationt *rte =
       dynamic_cast<runtime_encoded_equationt *>(target.get());
 
-    expr2tc the_question = equality2tc(gen_true_expr(), parent_guard);
-
     try
     {
-      tvt res = rte->ask_solver_question(the_question);
+      tvt res = rte->ask_solver_question(parent_guard, true);
       if (res.is_false())
         return true;
     }
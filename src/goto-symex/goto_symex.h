@@ -7,6 +7,7 @@
 #include <map>
 #include <pointer-analysis/dereference.h>
 #include <stack>
+#include <unordered_set>
 #include <util/i2string.h>
 #include <irep2/irep2.h>
 #include <util/options.h>
@@ -461,6 +462,37 @@ protected:
     reachability_treet &art,
     const code_function_call2t &func_call);
 
+  /**
+   * @brief Intrinsic call for C memcpy and memmove function calls
+   *
+   * Copies whole objects or element-aligned array regions directly when
+   * the offsets are known. A symbolic number of bytes is summarised element
+   * by element up to the end of the objects. Otherwise it invokes the
+   * operational model `impl` (at string.c)
+   *
+   * @param art
+   * @param func_call memcpy or memmove function call
+   * @param impl name of the operational model to fall back to
+   */
+  void intrinsic_memcpy(
+    reachability_treet &art,
+    const code_function_call2t &func_call,
+    const std::string &impl);
+
+  /**
+   * @brief Intrinsic call for C memcmp function calls
+   *
+   * Compares the bytes of both objects directly when the number of bytes
+   * and the offsets are known, otherwise it invokes the operational model
+   * (at string.c)
+   *
+   * @param art
+   * @param func_call memcmp function call
+   */
+  void intrinsic_memcmp(
+    reachability_treet &art,
+    const code_function_call2t &func_call);
+
   // Function to call a symname function, in case where were not able to optimize it
   void
   bump_call(const code_function_call2t &func_call, const std::string &symname);
@@ -757,6 +789,12 @@ protected:
   /** Wrapper around for alloca and malloc. */
   expr2tc
   symex_mem(const bool is_malloc, const expr2tc &lhs, const sideeffect2t &code);
+  /** The types that the program accesses as another type: a pointer to them
+   *  is converted to a pointer to another type that is not void, or the
+   *  other way round. */
+  static std::unordered_set<type2tc, type2_hash> collect_punned_types(
+    const goto_functionst &goto_functions,
+    const namespacet &ns);
   /** Pointer modelling update function */
   void track_new_pointer(
     const expr2tc &ptr_obj,
@@ -838,6 +876,12 @@ protected:
    *  Used to track what we should level memory-leak-assertions against when the
    *  program execution has finished */
   std::list<allocated_obj> dynamic_memory;
+  /** References built by dereferencing, shared by all the execution states
+   *  copied from this one. */
+  std::shared_ptr<dereference_cachet> dereference_cache;
+  /** With --byte-array-heap, the types whose heap objects are stored as
+   *  bytes, shared by all the execution states copied from this one. */
+  std::shared_ptr<const std::unordered_set<type2tc, type2_hash>> punned_types;
 
   /* Exception Handling.
    * This will stack the try-catch blocks, so we always know which catch
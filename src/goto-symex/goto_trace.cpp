@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 #include <goto-symex/goto_trace.h>
@@ -243,14 +244,21 @@ void violation_graphml_goto_trace(
   const namespacet &ns,
   const goto_tracet &goto_trace)
 {
-  grapht graph(grapht::VIOLATION);
-  graph.verified_file = options.get_option("input-file");
+  /* the witness is written while walking the trace, make sure it is going
+   * to end with a violation before starting it */
+  auto violation = std::find_if(
+    goto_trace.steps.begin(),
+    goto_trace.steps.end(),
+    [](const goto_trace_stept &step) {
+      return step.type == goto_trace_stept::ASSERT && !step.guard;
+    });
+  if (violation == goto_trace.steps.end())
+    return;
+
+  grapht graph(grapht::VIOLATION, options.get_option("input-file"), options);
 
   log_progress("Generating Violation Witness for: {}", graph.verified_file);
 
-  edget *first_edge = &graph.edges.at(0);
-  nodet *prev_node = first_edge->to_node;
-
   for (const auto &step : goto_trace.steps)
   {
     switch (step.type)
@@ -258,24 +266,23 @@ void violation_graphml_goto_trace(
     case goto_trace_stept::ASSERT:
       if (!step.guard)
       {
-        graph.check_create_new_thread(step.thread_nr, prev_node);
-        prev_node = graph.edges.back().to_node;
+        graph.check_create_new_thread(step.thread_nr);
 
-        nodet *violation_node = new nodet();
-        violation_node->violation = true;
+        nodet violation_node;
+        violation_node.violation = true;
 
-        edget violation_edge(prev_node, violation_node);
+        edget violation_edge(graph.last_node(), &violation_node);
         violation_edge.thread_id = std::to_string(step.thread_nr);
         violation_edge.start_line = get_line_number(
           graph.verified_file,
           std::atoi(step.pc->location.get_line().c_str()),
           options);
 
-        graph.edges.push_back(violation_edge);
+        graph.add_edge(violation_edge);
 
         /* having printed a property violation, don't print more steps. */
 
-        graph.generate_graphml(options);
+        graph.close();
         return;
       }
       break;
@@ -288,8 +295,7 @@ void violation_graphml_goto_trace(
       {
         std::string assignment = get_formated_assignment(ns, step);
 
-        graph.check_create_new_thread(step.thread_nr, prev_node);
-        prev_node = graph.edges.back().to_node;
+        graph.check_create_new_thread(step.thread_nr);
 
         edget new_edge;
         new_edge.thread_id = std::to_string(step.thread_nr);
@@ -299,11 +305,10 @@ void violation_graphml_goto_trace(
           std::atoi(step.pc->location.get_line().c_str()),
           options);
 
-        nodet *new_node = new nodet();
-        new_edge.from_node = prev_node;
-        new_edge.to_node = new_node;
-        prev_node = new_node;
-        graph.edges.push_back(new_edge);
+        nodet new_node;
+        new_edge.from_node = graph.last_node();
+        new_edge.to_node = &new_node;
+        graph.add_edge(new_edge);
       }
       break;
 
@@ -318,13 +323,9 @@ void correctness_graphml_goto_trace(
   const namespacet &ns,
   const goto_tracet &goto_trace)
 {
-  grapht graph(grapht::CORRECTNESS);
-  graph.verified_file = options.get_option("input-file");
+  grapht graph(grapht::CORRECTNESS, options.get_option("input-file"), options);
   log_progress("Generating Correctness Witness for: {}", graph.verified_file);
 
-  edget *first_edge = &graph.edges.at(0);
-  nodet *prev_node = first_edge->to_node;
-
   for (const auto &step : goto_trace.steps)
   {
     /* checking restrictions for correctness GraphML */
@@ -341,23 +342,22 @@ void correctness_graphml_goto_trace(
     if (invariant.empty())
       continue; /* we don't have to consider this invariant */
 
-    nodet *new_node = new nodet();
-    edget *new_edge = new edget();
+    nodet new_node;
+    edget new_edge;
     std::string function = step.pc->location.get_function().c_str();
-    new_edge->start_line = get_line_number(
+    new_edge.start_line = get_line_number(
       graph.verified_file,
       std::atoi(step.pc->location.get_line().c_str()),
       options);
-    new_node->invariant = invariant;
-    new_node->invariant_scope = function;
+    new_node.invariant = invariant;
+    new_node.invariant_scope = function;
 
-    new_edge->from_node = prev_node;
-    new_edge->to_node = new_node;
-    prev_node = new_node;
-    graph.edges.push_back(*new_edge);
+    new_edge.from_node = graph.last_node();
+    new_edge.to_node = &new_node;
+    graph.add_edge(new_edge);
   }
 
-  graph.generate_graphml(options);
+  graph.close();
 }
 
 void show_goto_trace(
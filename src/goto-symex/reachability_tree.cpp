@@ -14,6 +14,7 @@
 #include <util/expr_util.h>
 #include <util/i2string.h>
 #include <util/message.h>
+#include <util/perf_report.h>
 #include <util/std_expr.h>
 
 reachability_treet::reachability_treet(
@@ -524,6 +525,7 @@ bool reachability_treet::check_thread_viable(unsigned int tid, bool quiet) const
 goto_symext::symex_resultt reachability_treet::get_next_formula()
 {
   assert(execution_states.size() > 0 && "Must setup RT before exploring");
+  perf_phaset phase("symex");
 
   while (!is_has_complete_formula())
   {
@@ -573,6 +575,7 @@ bool reachability_treet::setup_next_formula()
 
 goto_symext::symex_resultt reachability_treet::generate_schedule_formula()
 {
+  perf_phaset phase("symex");
   int total_states = 0;
   while (has_more_states())
   {
@@ -1,5 +1,7 @@
 #include <goto-symex/slice.h>
 
+#include <functional>
+#include <unordered_map>
 #include <util/prefix.h>
 static bool no_slice(const symbol2t &sym)
 {
@@ -129,6 +131,7 @@ void symex_slicet::run_on_renumber(symex_target_equationt::SSA_stept &SSA_step)
  */
 bool simple_slice::run(symex_target_equationt::SSA_stepst &steps)
 {
+  perf_phaset phase("slice");
   sliced = 0;
   fine_timet algorithm_start = current_time();
   // just find the last assertion
@@ -161,6 +164,7 @@ bool simple_slice::run(symex_target_equationt::SSA_stepst &steps)
 
 bool claim_slicer::run(symex_target_equationt::SSA_stepst &steps)
 {
+  perf_phaset phase("slice-claim");
   sliced = 0;
   fine_timet algorithm_start = current_time();
   size_t counter = 1;
@@ -207,6 +211,124 @@ bool claim_slicer::run(symex_target_equationt::SSA_stepst &steps)
 
   return true;
 }
+
+namespace
+{
+/* Union-find over the nodes of the formula: one per symbol plus one per
+ * step. */
+class disjoint_sett
+{
+public:
+  size_t make()
+  {
+    parent.push_back(parent.size());
+    return parent.back();
+  }
+
+  size_t find(size_t n)
+  {
+    while (parent[n] != n)
+      n = parent[n] = parent[parent[n]];
+    return n;
+  }
+
+  void join(size_t a, size_t b)
+  {
+    parent[find(a)] = find(b);
+  }
+
+private:
+  std::vector<size_t> parent;
+};
+} // namespace
+
+size_t component_slicer::partition(
+  const symex_target_equationt::SSA_stepst &steps,
+  std::vector<size_t> &components)
+{
+  perf_phaset phase("slice-components");
+  disjoint_sett sets;
+  std::unordered_map<std::string, size_t> symbols;
+
+  std::function<void(const expr2tc &, size_t)> join_symbols =
+    [&](const expr2tc &expr, size_t node) {
+      if (is_nil_expr(expr))
+        return;
+
+      expr->foreach_operand(
+        [&](const expr2tc &e) { join_symbols(e, node); });
+
+      if (!is_symbol2t(expr))
+        return;
+
+      auto [it, fresh] =
+        symbols.emplace(to_symbol2t(expr).get_symbol_name(), 0);
+      if (fresh)
+        it->second = sets.make();
+      sets.join(it->second, node);
+    };
+
+  // Every assume and every claim that follows one share this node
+  const size_t assumptions = sets.make();
+  bool seen_assume = false;
+
+  std::vector<size_t> nodes;
+  nodes.reserve(steps.size());
+  for (const auto &step : steps)
+  {
+    size_t node = sets.make();
+    nodes.push_back(node);
+    if (step.ignore)
+      continue;
+
+    join_symbols(step.guard, node);
+    join_symbols(step.cond, node);
+    join_symbols(step.lhs, node);
+    join_symbols(step.rhs, node);
+    for (const expr2tc &arg : step.output_args)
+      join_symbols(arg, node);
+
+    if (step.is_assume())
+      seen_assume = true;
+
+    if (step.is_assume() || (step.is_assert() && seen_assume))
+      sets.join(node, assumptions);
+  }
+
+  // Number the components with claims in order of their first claim
+  std::unordered_map<size_t, size_t> numbering;
+  auto step = steps.begin();
+  for (size_t i = 0; i < nodes.size(); i++, step++)
+    if (step->is_assert() && !step->ignore)
+      numbering.emplace(sets.find(nodes[i]), numbering.size());
+
+  components.clear();
+  components.reserve(nodes.size());
+  for (size_t node : nodes)
+  {
+    auto it = numbering.find(sets.find(node));
+    components.push_back(it == numbering.end() ? SIZE_MAX : it->second);
+  }
+
+  return numbering.size();
+}
+
+bool component_slicer::run(symex_target_equationt::SSA_stepst &steps)
+{
+  assert(components.size() == steps.size());
+  sliced = 0;
+  auto component = components.begin();
+  for (auto &step : steps)
+  {
+    if (*component++ != to_keep && !step.ignore)
+    {
+      step.ignore = true;
+      ++sliced;
+    }
+  }
+  return true;
+}
+
 // Recursively try to extract the nondet symbol of an expression
 expr2tc symex_slicet::get_nondet_symbol(const expr2tc &expr)
 {
@@ -5,6 +5,7 @@
 #include <util/time_stopping.h>
 #include <util/algorithms.h>
 #include <util/options.h>
+#include <util/perf_report.h>
 #include <boost/range/adaptor/reversed.hpp>
 #include <langapi/language_util.h>
 
@@ -69,6 +70,40 @@ public:
   namespacet ns;
 };
 
+/**
+ * Component slicer: keep only the steps of one independent component of the
+ * formula, as computed by #partition.
+ *
+ * Two steps belong to the same component if they (transitively) share a
+ * symbol. Assumptions restrict every claim that follows them, so all assumes
+ * and every claim after the first assume are put into a single component.
+ * The formula is then satisfiable iff one of its components is.
+ */
+class component_slicer : public slicer
+{
+public:
+  component_slicer(const std::vector<size_t> &components, size_t to_keep)
+    : components(components), to_keep(to_keep)
+  {
+  }
+
+  /**
+   * Assign each step of \steps the component it belongs to, or SIZE_MAX if
+   * its component has no claim and can be dropped.
+   *
+   * @return number of components with at least one claim
+   */
+  static size_t partition(
+    const symex_target_equationt::SSA_stepst &steps,
+    std::vector<size_t> &components);
+
+  bool run(symex_target_equationt::SSA_stepst &) override;
+
+protected:
+  const std::vector<size_t> &components;
+  const size_t to_keep;
+};
+
 /**
  * @brief Class for the symex-slicer, this slicer is to be executed
  * on SSA formula in order to remove every symbol that does not depends
@@ -97,6 +132,7 @@ public:
    */
   bool run(symex_target_equationt::SSA_stepst &eq) override
   {
+    perf_phaset phase("slice");
     sliced = 0;
     fine_timet algorithm_start = current_time();
     for (auto &step : boost::adaptors::reverse(eq))
@@ -0,0 +1,267 @@
+#include <goto-symex/ssa_preprocess.h>
+#include <functional>
+#include <irep2/irep2_utils.h>
+#include <unordered_set>
+#include <util/message.h>
+#include <util/perf_report.h>
+#include <util/time_stopping.h>
+
+static bool is_scalar(const expr2tc &expr)
+{
+  return is_bool_type(expr) || is_bv_type(expr) || is_fixedbv_type(expr);
+}
+
+expr2tc ssa_preprocesst::replace(
+  const expr2tc &expr,
+  const expr_mapt &map,
+  memot &memo)
+{
+  if (is_nil_expr(expr))
+    return expr;
+
+  auto it = map.find(expr);
+  if (it != map.end())
+    return it->second;
+
+  // Neither symbols nor addresses have anything to rewrite inside
+  if (is_symbol2t(expr) || is_address_of2t(expr))
+    return expr;
+
+  auto m = memo.find(expr.get());
+  if (m != memo.end())
+    return m->second.second;
+
+  std::vector<expr2tc> ops;
+  bool changed = false;
+  expr->foreach_operand([&](const expr2tc &op) {
+    const expr2tc res = replace(op, map, memo);
+    changed |= res.get() != op.get();
+    ops.push_back(res);
+  });
+
+  expr2tc res = expr;
+  if (changed)
+  {
+    size_t i = 0;
+    res->Foreach_operand([&ops, &i](expr2tc &op) { op = ops[i++]; });
+    simplify(res);
+  }
+
+  // Keep the original alive, its address is the key
+  memo.emplace(expr.get(), std::make_pair(expr, res));
+  return res;
+}
+
+/// Number of structurally distinct nodes in the formula
+static size_t formula_size(const symex_target_equationt::SSA_stepst &steps)
+{
+  std::unordered_set<expr2tc, irep2_hash> seen;
+  std::function<void(const expr2tc &)> visit = [&](const expr2tc &e) {
+    if (is_nil_expr(e) || !seen.insert(e).second)
+      return;
+    e->foreach_operand(visit);
+  };
+
+  for (const auto &step : steps)
+  {
+    if (step.ignore)
+      continue;
+
+    visit(step.guard);
+    visit(step.cond);
+  }
+
+  return seen.size();
+}
+
+bool ssa_preprocesst::run(symex_target_equationt::SSA_stepst &steps)
+{
+  perf_phaset phase("ssa-preprocess");
+  fine_timet algorithm_start = current_time();
+  removed = propagated = inlined = merged = strengthened = 0;
+
+  for (const auto &step : steps)
+  {
+    if (step.ignore)
+      continue;
+
+    count_uses(step.guard);
+    count_uses(step.original_lhs);
+    count_uses(step.original_rhs);
+    for (const expr2tc &arg : step.output_args)
+      count_uses(arg);
+
+    if (step.is_assignment())
+      count_uses(step.rhs);
+    else if (step.is_assert() || step.is_assume())
+      count_uses(step.cond);
+    else if (step.is_renumber())
+      count_uses(step.rhs);
+  }
+
+  size_t size_before = formula_size(steps);
+
+  for (auto &step : steps)
+  {
+    if (!step.ignore)
+      run_on_step(step);
+  }
+
+  size_t size_after = formula_size(steps);
+
+  subst.clear();
+  memo.clear();
+  uses.clear();
+  defined.clear();
+
+  fine_timet algorithm_stop = current_time();
+  log_status(
+    "SSA preprocessing time: {}s ({} propagated, {} inlined, {} merged, {} "
+    "strengthened; removed {} steps, formula size {} -> {})",
+    time2string(algorithm_stop - algorithm_start),
+    propagated,
+    inlined,
+    merged,
+    strengthened,
+    removed,
+    size_before,
+    size_after);
+
+  return true;
+}
+
+void ssa_preprocesst::count_uses(const expr2tc &expr)
+{
+  if (is_nil_expr(expr))
+    return;
+
+  if (is_symbol2t(expr))
+  {
+    uses[expr]++;
+    return;
+  }
+
+  expr->foreach_operand([this](const expr2tc &e) { count_uses(e); });
+}
+
+void ssa_preprocesst::rewrite_common(symex_target_equationt::SSA_stept &step)
+{
+  step.guard = replace(step.guard, subst, memo);
+  step.original_lhs = replace(step.original_lhs, subst, memo);
+  step.original_rhs = replace(step.original_rhs, subst, memo);
+  for (expr2tc &arg : step.output_args)
+    arg = replace(arg, subst, memo);
+}
+
+void ssa_preprocesst::run_on_assignment(symex_target_equationt::SSA_stept &step)
+{
+  rewrite_common(step);
+  step.rhs = replace(step.rhs, subst, memo);
+
+  const expr2tc &lhs = step.lhs;
+  if (
+    is_symbol2t(lhs) && !is_nil_expr(step.rhs) && is_scalar(lhs) &&
+    lhs->type == step.rhs->type)
+  {
+    if (is_constant_expr(step.rhs) || is_symbol2t(step.rhs))
+    {
+      subst[lhs] = step.rhs;
+      ++propagated;
+    }
+    else if (auto it = defined.find(step.rhs); it != defined.end())
+    {
+      step.rhs = it->second;
+      subst[lhs] = it->second;
+      ++merged;
+    }
+    else if (step.hidden && uses[lhs] == 1)
+    {
+      subst[lhs] = step.rhs;
+      ++inlined;
+    }
+    else
+      defined.emplace(step.rhs, lhs);
+
+    // Whatever read the symbol now reads its value instead
+    if (step.hidden && subst.count(lhs))
+    {
+      step.ignore = true;
+      ++removed;
+    }
+  }
+
+  step.cond = equality2tc(lhs, step.rhs);
+}
+
+void ssa_preprocesst::run_on_assume(symex_target_equationt::SSA_stept &step)
+{
+  rewrite_common(step);
+  step.cond = strengthen(replace(step.cond, subst, memo));
+
+  if (is_true(step.cond))
+  {
+    step.ignore = true;
+    ++removed;
+  }
+}
+
+void ssa_preprocesst::run_on_assert(symex_target_equationt::SSA_stept &step)
+{
+  // Assertions that became trivially true are kept: they are what the
+  // claims are reported from
+  rewrite_common(step);
+  step.cond = strengthen(replace(step.cond, subst, memo));
+}
+
+void ssa_preprocesst::run_on_output(symex_target_equationt::SSA_stept &step)
+{
+  rewrite_common(step);
+}
+
+void ssa_preprocesst::run_on_skip(symex_target_equationt::SSA_stept &step)
+{
+  rewrite_common(step);
+}
+
+void ssa_preprocesst::run_on_renumber(symex_target_equationt::SSA_stept &step)
+{
+  rewrite_common(step);
+  step.rhs = replace(step.rhs, subst, memo);
+}
+
+expr2tc ssa_preprocesst::strengthen(const expr2tc &cond)
+{
+  // Conditions are guarded as guard => cond: cond only matters when every
+  // conjunct of the guard holds, so simplify it assuming they do
+  if (!is_implies2t(cond))
+    return cond;
+
+  const implies2t &imp = to_implies2t(cond);
+  expr_mapt facts;
+  std::vector<expr2tc> todo(1, imp.side_1);
+  while (!todo.empty())
+  {
+    expr2tc e = todo.back();
+    todo.pop_back();
+
+    if (is_and2t(e))
+    {
+      todo.push_back(to_and2t(e).side_1);
+      todo.push_back(to_and2t(e).side_2);
+    }
+    else if (is_not2t(e))
+      facts[to_not2t(e).value] = gen_false_expr();
+    else if (!is_constant_expr(e))
+      facts[e] = gen_true_expr();
+  }
+
+  memot local;
+  const expr2tc side_2 = replace(imp.side_2, facts, local);
+  if (side_2.get() == imp.side_2.get())
+    return cond;
+
+  ++strengthened;
+  expr2tc res = implies2tc(imp.side_1, side_2);
+  simplify(res);
+  return res;
+}
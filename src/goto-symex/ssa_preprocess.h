@@ -0,0 +1,77 @@
+#ifndef CPROVER_GOTO_SYMEX_SSA_PREPROCESS_H
+#define CPROVER_GOTO_SYMEX_SSA_PREPROCESS_H
+
+#include <goto-symex/symex_target_equation.h>
+#include <unordered_map>
+#include <util/algorithms.h>
+
+/**
+ * @brief Simplifies the SSA formula as a whole before it is handed to the
+ * solver, rather than one expression at a time
+ *
+ * Walking the steps in order, it
+ *  - propagates constants and copies assigned to scalar symbols into the
+ *    rest of the formula,
+ *  - inlines definitions of internal symbols that are used only once,
+ *  - merges assignments of the same expression into copies of the first,
+ *  - simplifies the condition of each assertion and assumption under its
+ *    guard.
+ *
+ * Every assignment is an unconditional equality, so substituting a symbol by
+ * its definition is sound anywhere after it. Definitions are only dropped
+ * from the formula for hidden steps: the counterexample still shows every
+ * assignment of the program.
+ */
+class ssa_preprocesst : public ssa_step_algorithm
+{
+public:
+  ssa_preprocesst() : ssa_step_algorithm(true)
+  {
+  }
+
+  bool run(symex_target_equationt::SSA_stepst &steps) override;
+
+  BigInt ignored() const override
+  {
+    return removed;
+  }
+
+protected:
+  typedef std::unordered_map<expr2tc, expr2tc, irep2_hash> expr_mapt;
+  typedef std::unordered_map<const expr2t *, std::pair<expr2tc, expr2tc>>
+    memot;
+
+  void run_on_assignment(symex_target_equationt::SSA_stept &step) override;
+  void run_on_assume(symex_target_equationt::SSA_stept &step) override;
+  void run_on_assert(symex_target_equationt::SSA_stept &step) override;
+  void run_on_output(symex_target_equationt::SSA_stept &step) override;
+  void run_on_skip(symex_target_equationt::SSA_stept &step) override;
+  void run_on_renumber(symex_target_equationt::SSA_stept &step) override;
+
+  /// Replace every subterm of expr found in map by what it maps to and
+  /// simplify what changed on the way back up. Shared subterms are only
+  /// rewritten once.
+  static expr2tc
+  replace(const expr2tc &expr, const expr_mapt &map, memot &memo);
+
+  void count_uses(const expr2tc &expr);
+  void rewrite_common(symex_target_equationt::SSA_stept &step);
+  expr2tc strengthen(const expr2tc &cond);
+
+  /// Symbols and what to replace them with
+  expr_mapt subst;
+  /// Rewritten subterms of the formula, by their original
+  memot memo;
+  /// Number of references to each symbol left in the formula
+  std::unordered_map<expr2tc, unsigned, irep2_hash> uses;
+  /// Right-hand sides assigned so far, to the symbol they were assigned to
+  expr_mapt defined;
+
+  BigInt removed = 0;
+  BigInt propagated = 0;
+  BigInt inlined = 0;
+  BigInt merged = 0;
+  BigInt strengthened = 0;
+};
+
+#endif
@@ -29,6 +29,12 @@ goto_symext::goto_symext(
     goto_functions(_goto_functions),
     target(std::move(_target)),
     cur_state(nullptr),
+    dereference_cache(std::make_shared<dereference_cachet>()),
+    punned_types(
+      options.get_bool_option("byte-array-heap")
+        ? std::make_shared<const std::unordered_set<type2tc, type2_hash>>(
+            collect_punned_types(goto_functions, ns))
+        : nullptr),
     last_throw(nullptr),
     inside_unexpected(false),
     no_return_value_opt(options.get_bool_option("no-return-value-opt")),
@@ -112,6 +118,8 @@ goto_symext &goto_symext::operator=(const goto_symext &sym)
   dyn_info_arr_name = sym.dyn_info_arr_name;
 
   dynamic_memory = sym.dynamic_memory;
+  dereference_cache = sym.dereference_cache;
+  punned_types = sym.punned_types;
 
   // Art ptr is shared
   art1 = sym.art1;
@@ -27,10 +27,9 @@ void goto_symext::symex_goto(const expr2tc &old_guard)
   {
     auto rte = std::dynamic_pointer_cast<runtime_encoded_equationt>(target);
 
-    expr2tc question = equality2tc(gen_true_expr(), new_guard);
     try
     {
-      tvt res = rte->ask_solver_question(question);
+      tvt res = rte->ask_solver_question(new_guard, true);
 
       if (res.is_false())
         new_guard_false = true;
@@ -23,11 +23,10 @@
 bool goto_symext::check_incremental(const expr2tc &expr, const std::string &msg)
 {
   auto rte = std::dynamic_pointer_cast<runtime_encoded_equationt>(target);
-  expr2tc question = equality2tc(gen_true_expr(), expr);
   try
   {
     // check whether the assertion holds
-    tvt res = rte->ask_solver_question(question);
+    tvt res = rte->ask_solver_question(expr);
     // we don't add this assertion to the resulting logical formula
     if (res.is_true())
       // incremental verification succeeded
@@ -498,6 +497,24 @@ void goto_symext::run_intrinsic(
     return;
   }
 
+  if (symname == "c:@F@__ESBMC_memcpy")
+  {
+    intrinsic_memcpy(art, func_call, "c:@F@__memcpy_impl");
+    return;
+  }
+
+  if (symname == "c:@F@__ESBMC_memmove")
+  {
+    intrinsic_memcpy(art, func_call, "c:@F@__memmove_impl");
+    return;
+  }
+
+  if (symname == "c:@F@__ESBMC_memcmp")
+  {
+    intrinsic_memcmp(art, func_call);
+    return;
+  }
+
   if (symname == "c:@F@__ESBMC_get_object_size")
   {
     intrinsic_get_object_size(func_call, art);
@@ -7,8 +7,14 @@
 #include <util/i2string.h>
 #include <irep2/irep2.h>
 #include <util/migrate.h>
+#include <util/perf_report.h>
 #include <util/std_expr.h>
 
+static perf_countert questions_cached("smt-questions-cached");
+static perf_countert questions_screened("smt-questions-screened");
+static perf_countert questions_over_budget("smt-questions-over-budget");
+static perf_countert questions_solved("smt-questions-solved");
+
 void symex_target_equationt::debug_print_step(const SSA_stept &step) const
 {
   std::ostringstream oss;
@@ -385,6 +391,9 @@ runtime_encoded_equationt::runtime_encoded_equationt(
   assert_vec_list.emplace_back();
   assumpt_chain.push_back(conv.convert_ast(gen_true_expr()));
   cvt_progress = SSA_steps.end();
+
+  const std::string budget = config.options.get_option("smt-symex-budget");
+  solver_budget = budget.empty() ? 0 : std::stoull(budget);
 }
 
 void runtime_encoded_equationt::flush_latest_instructions()
@@ -415,8 +424,11 @@ void runtime_encoded_equationt::flush_latest_instructions()
 
   // Now iterate from the start insn to convert, to the end of the list.
   for (; run_it != SSA_steps.end(); ++run_it)
+  {
     convert_internal_step(
       conv, assumpt_chain.back(), assert_vec_list.back(), *run_it);
+    learn_intervals(*run_it);
+  }
 
   run_it--;
   cvt_progress = run_it;
@@ -430,6 +442,7 @@ void runtime_encoded_equationt::push_ctx()
   assumpt_chain.push_back(assumpt_chain.back());
   assert_vec_list.push_back(assert_vec_list.back());
   scoped_end_points.push_back(cvt_progress);
+  log_marks.emplace_back(answers_log.size(), intervals_log.size());
   conv.push_ctx();
 }
 
@@ -447,6 +460,26 @@ void runtime_encoded_equationt::pop_ctx()
   scoped_end_points.pop_back();
   assert_vec_list.pop_back();
   assumpt_chain.pop_back();
+
+  // Forget what was learnt about the steps we just dropped
+  auto [answers_mark, intervals_mark] = log_marks.back();
+  log_marks.pop_back();
+  for (; answers_log.size() > answers_mark; answers_log.pop_back())
+  {
+    auto &[question, old] = answers_log.back();
+    if (old)
+      answers[question] = *old;
+    else
+      answers.erase(question);
+  }
+  for (; intervals_log.size() > intervals_mark; intervals_log.pop_back())
+  {
+    auto &[name, old] = intervals_log.back();
+    if (old)
+      intervals[name] = *old;
+    else
+      intervals.erase(name);
+  }
 }
 
 void runtime_encoded_equationt::convert(smt_convt &smt_conv)
@@ -478,8 +511,49 @@ std::shared_ptr<symex_targett> runtime_encoded_equationt::clone() const
   return nthis;
 }
 
-tvt runtime_encoded_equationt::ask_solver_question(const expr2tc &question)
+tvt runtime_encoded_equationt::ask_solver_question(
+  const expr2tc &question,
+  bool prune_only)
 {
+  assert(is_bool_type(question));
+
+  // Bring the ranges and the solver up to date with the formula
+  flush_latest_instructions();
+
+  auto cached = answers.find(question);
+  if (
+    cached != answers.end() &&
+    (!cached->second.value.is_unknown() ||
+     cached->second.num_steps == SSA_steps.size()))
+  {
+    questions_cached.add();
+    if (cached->second.dual_unsat)
+      throw dual_unsat_exception();
+    return cached->second.value;
+  }
+
+  auto remember = [this, &question](tvt value, bool dual_unsat) {
+    auto it = answers.find(question);
+    answers_log.emplace_back(
+      question,
+      it == answers.end() ? std::nullopt : std::optional(it->second));
+    answers[question] = {value, dual_unsat, SSA_steps.size()};
+  };
+
+  tvt screened = screen_question(question);
+  if (!screened.is_unknown())
+  {
+    questions_screened.add();
+    remember(screened, false);
+    return screened;
+  }
+
+  if (solver_budget && solver_queries >= solver_budget)
+  {
+    questions_over_budget.add();
+    return tvt(tvt::TV_UNKNOWN);
+  }
+
   tvt final_res;
 
   // So - we have a formula, we want to work out whether it's true, false, or
@@ -488,7 +562,6 @@ tvt runtime_encoded_equationt::ask_solver_question(const expr2tc &question)
   push_ctx();
 
   // Convert the question (must be a bool).
-  assert(is_bool_type(question));
   smt_astt q = conv.convert_ast(question);
 
   // The proposition also needs to be guarded with the in-program assumptions,
@@ -505,10 +578,19 @@ tvt runtime_encoded_equationt::ask_solver_question(const expr2tc &question)
   conv.assert_ast(q);
   smt_convt::resultt res1 = conv.dec_solve();
   pop_ctx();
-  push_ctx();
-  conv.assert_ast(conv.invert_ast(q));
-  smt_convt::resultt res2 = conv.dec_solve();
-  pop_ctx();
+  solver_queries++;
+
+  // If the proposition can't hold, pruning doesn't care why
+  smt_convt::resultt res2 = smt_convt::P_SATISFIABLE;
+  if (!prune_only || res1 != smt_convt::P_UNSATISFIABLE)
+  {
+    push_ctx();
+    conv.assert_ast(conv.invert_ast(q));
+    res2 = conv.dec_solve();
+    pop_ctx();
+    solver_queries++;
+  }
+  questions_solved.add();
 
   // So; which result?
   if (
@@ -538,11 +620,180 @@ tvt runtime_encoded_equationt::ask_solver_question(const expr2tc &question)
   else
   {
     pop_ctx();
+    remember(tvt(tvt::TV_UNKNOWN), true);
     throw dual_unsat_exception();
   }
 
   // We have our result; pop off the questions / formula we've asked.
   pop_ctx();
 
+  remember(final_res, false);
   return final_res;
 }
+
+/* Narrow the ranges of symbols from constant assignments and from assumptions
+ * that bound a symbol by a constant. */
+void runtime_encoded_equationt::learn_intervals(const SSA_stept &step)
+{
+  if (step.ignore)
+    return;
+
+  if (
+    step.is_assignment() && is_symbol2t(step.lhs) &&
+    is_constant_int2t(step.rhs))
+    set_interval(
+      to_symbol2t(step.lhs).get_symbol_name(),
+      intervalt(to_constant_int2t(step.rhs).value));
+  else if (step.is_assume())
+    restrict_interval(step.cond);
+}
+
+void runtime_encoded_equationt::restrict_interval(const expr2tc &cond)
+{
+  if (is_and2t(cond))
+  {
+    restrict_interval(to_and2t(cond).side_1);
+    restrict_interval(to_and2t(cond).side_2);
+    return;
+  }
+
+  if (!is_comp_expr(cond) || is_notequal2t(cond))
+    return;
+
+  expr2tc lhs = *cond->get_sub_expr(0);
+  expr2tc rhs = *cond->get_sub_expr(1);
+  bool flipped = false;
+  if (is_constant_int2t(lhs))
+  {
+    std::swap(lhs, rhs);
+    flipped = true;
+  }
+
+  if (!is_symbol2t(lhs) || !is_bv_type(lhs) || !is_constant_int2t(rhs))
+    return;
+
+  const BigInt &c = to_constant_int2t(rhs).value;
+  intervalt interval = get_interval(lhs);
+  if (is_equality2t(cond))
+    interval.intersect_with(intervalt(c));
+  else
+  {
+    bool less = is_lessthan2t(cond) || is_lessthanequal2t(cond);
+    bool strict = is_lessthan2t(cond) || is_greaterthan2t(cond);
+    // The symbol is bounded from above if it is on the smaller side
+    if (less != flipped)
+      interval.make_le_than(strict ? c - 1 : c);
+    else
+      interval.make_ge_than(strict ? c + 1 : c);
+  }
+
+  set_interval(to_symbol2t(lhs).get_symbol_name(), interval);
+}
+
+void runtime_encoded_equationt::set_interval(
+  const std::string &name,
+  const intervalt &interval)
+{
+  auto it = intervals.find(name);
+  intervals_log.emplace_back(
+    name, it == intervals.end() ? std::nullopt : std::optional(it->second));
+  intervals[name] = interval;
+}
+
+runtime_encoded_equationt::intervalt
+runtime_encoded_equationt::get_interval(const expr2tc &expr) const
+{
+  if (is_constant_int2t(expr))
+    return intervalt(to_constant_int2t(expr).value);
+
+  // Casts that keep every value of the operand
+  if (is_typecast2t(expr) && is_bv_type(expr))
+  {
+    const expr2tc &from = to_typecast2t(expr).from;
+    unsigned from_width = from->type->get_width();
+    unsigned to_width = expr->type->get_width();
+    if (
+      is_bv_type(from) &&
+      (is_signedbv_type(from) == is_signedbv_type(expr)
+         ? to_width >= from_width
+         : is_unsignedbv_type(from) && to_width > from_width))
+      return get_interval(from);
+  }
+
+  intervalt interval;
+  if (is_signedbv_type(expr))
+  {
+    BigInt half = BigInt::power2(expr->type->get_width() - 1);
+    interval = intervalt(-half, half - 1);
+  }
+  else if (is_unsignedbv_type(expr))
+    interval = intervalt(0, BigInt::power2m1(expr->type->get_width()));
+
+  if (is_symbol2t(expr))
+  {
+    auto it = intervals.find(to_symbol2t(expr).get_symbol_name());
+    if (it != intervals.end())
+      interval.intersect_with(it->second);
+  }
+
+  return interval;
+}
+
+/* Answer what the constants and known ranges decide without the solver. */
+tvt runtime_encoded_equationt::screen_question(const expr2tc &question) const
+{
+  if (is_constant_bool2t(question))
+    return tvt(to_constant_bool2t(question).value);
+
+  if (is_not2t(question))
+    return !screen_question(to_not2t(question).value);
+
+  if (is_and2t(question))
+    return screen_question(to_and2t(question).side_1) &&
+           screen_question(to_and2t(question).side_2);
+
+  if (is_or2t(question))
+    return screen_question(to_or2t(question).side_1) ||
+           screen_question(to_or2t(question).side_2);
+
+  if (!is_comp_expr(question))
+    return tvt(tvt::TV_UNKNOWN);
+
+  const expr2tc &side_1 = *question->get_sub_expr(0);
+  const expr2tc &side_2 = *question->get_sub_expr(1);
+
+  // true == guard, as the callers used to phrase their questions
+  if (is_equality2t(question) && is_bool_type(side_1))
+  {
+    if (is_constant_bool2t(side_1))
+      return to_constant_bool2t(side_1).value ? screen_question(side_2)
+                                              : !screen_question(side_2);
+    return tvt(tvt::TV_UNKNOWN);
+  }
+
+  if (!is_bv_type(side_1) || !is_bv_type(side_2))
+    return tvt(tvt::TV_UNKNOWN);
+
+  intervalt a = get_interval(side_1);
+  intervalt b = get_interval(side_2);
+
+  if (is_lessthan2t(question))
+    return a < b;
+  if (is_lessthanequal2t(question))
+    return a <= b;
+  if (is_greaterthan2t(question))
+    return a > b;
+  if (is_greaterthanequal2t(question))
+    return a >= b;
+
+  tvt equal(tvt::TV_UNKNOWN);
+  if (a.singleton() && b.singleton() && a.get_lower() == b.get_lower())
+    equal = tvt(true);
+  else
+  {
+    a.intersect_with(b);
+    if (a.empty())
+      equal = tvt(false);
+  }
+  return is_equality2t(question) ? equal : !equal;
+}
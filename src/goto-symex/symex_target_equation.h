@@ -4,15 +4,18 @@
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
+#include <goto-programs/abstract-interpretation/interval_template.h>
 #include <goto-programs/goto_program.h>
 #include <goto-symex/goto_trace.h>
 #include <goto-symex/symex_target.h>
 #include <list>
 #include <map>
+#include <optional>
 #include <solvers/smt/smt_conv.h>
 #include <util/config.h>
 #include <irep2/irep2.h>
 #include <util/namespace.h>
+#include <unordered_map>
 #include <vector>
 
 class symex_target_equationt : public symex_targett
@@ -226,13 +229,55 @@ public:
   void convert(smt_convt &smt_conv) override;
   void flush_latest_instructions();
 
-  tvt ask_solver_question(const expr2tc &question);
+  /**
+   * Work out whether the boolean \question is true, false or unknown given
+   * the formula so far.
+   *
+   * Previous answers are cached, and the question is screened against the
+   * value ranges the formula implies for its symbols before the solver is
+   * asked. No solver query is issued once --smt-symex-budget is spent.
+   *
+   * With \prune_only, callers treat false and unsatisfiable assumptions
+   * alike, so a question that cannot be true is answered false without a
+   * second query.
+   */
+  tvt ask_solver_question(const expr2tc &question, bool prune_only = false);
 
   smt_convt &conv;
   std::list<smt_convt::ast_vec> assert_vec_list;
   std::list<smt_astt> assumpt_chain;
   std::list<SSA_stepst::iterator> scoped_end_points;
   SSA_stepst::iterator cvt_progress;
+
+protected:
+  typedef interval_templatet<BigInt> intervalt;
+
+  struct answert
+  {
+    tvt value;
+    bool dual_unsat;
+    /// Unknown answers only hold until the formula changes
+    size_t num_steps;
+  };
+
+  void learn_intervals(const SSA_stept &step);
+  void restrict_interval(const expr2tc &cond);
+  void set_interval(const std::string &name, const intervalt &interval);
+  intervalt get_interval(const expr2tc &expr) const;
+  tvt screen_question(const expr2tc &question) const;
+
+  std::unordered_map<expr2tc, answert, irep2_hash> answers;
+  std::unordered_map<std::string, intervalt> intervals;
+
+  /* What pop_ctx needs to forget: the previous entries of the maps above,
+   * and where each context starts in these logs. */
+  std::vector<std::pair<expr2tc, std::optional<answert>>> answers_log;
+  std::vector<std::pair<std::string, std::optional<intervalt>>> intervals_log;
+  std::list<std::pair<size_t, size_t>> log_marks;
+
+  /// Maximum number of solver queries, zero if unlimited
+  uint64_t solver_budget;
+  uint64_t solver_queries = 0;
 };
 
 extern inline bool operator<(
@@ -14,78 +14,50 @@ typedef boost::property_tree::ptree xmlnodet;
 BigInt nodet::_id = 0;
 BigInt edget::_id = 0;
 
-void grapht::generate_graphml(optionst &options)
+grapht::grapht(typet t, const std::string &_verified_file, optionst &options)
+  : witness_type(t), verified_file(_verified_file)
 {
-  xmlnodet graphml_node;
-  create_graphml(graphml_node);
-
-  xmlnodet graph_node;
-  if (this->witness_type == grapht::VIOLATION)
-    create_violation_graph_node(this->verified_file, options, graph_node);
+  std::string witness_output = options.get_option("witness-output");
+  if (witness_output == "-")
+    out = &std::cout;
   else
-    create_correctness_graph_node(this->verified_file, options, graph_node);
-
-  nodet *prev_node = nullptr;
-  for (auto &current_edge : this->edges)
   {
-    if (prev_node == nullptr || prev_node != current_edge.from_node)
-    {
-      xmlnodet from_node_node;
-      create_node_node(*current_edge.from_node, from_node_node);
-      graph_node.add_child("node", from_node_node);
-    }
-    xmlnodet to_node_node;
-    create_node_node(*current_edge.to_node, to_node_node);
-    graph_node.add_child("node", to_node_node);
-    xmlnodet edge_node;
-    create_edge_node(current_edge, edge_node);
-    graph_node.add_child("edge", edge_node);
-    prev_node = current_edge.to_node;
+    file.open(witness_output);
+    if (!file)
+      log_error("Failed to open witness output file `{}'", witness_output);
+    out = &file;
   }
-  graphml_node.add_child("graphml.graph", graph_node);
 
-#if (BOOST_VERSION >= 105700)
-  boost::property_tree::xml_writer_settings<std::string> settings(' ', 2);
-#else
-  boost::property_tree::xml_writer_settings<char> settings(' ', 2);
-#endif
+  compact = options.get_bool_option("witness-compact");
 
-  std::string witness_output = options.get_option("witness-output");
-  if (witness_output == "-")
-    boost::property_tree::write_xml(std::cout, graphml_node, settings);
-  else
-    boost::property_tree::write_xml(
-      witness_output, graphml_node, std::locale(), settings);
+  write_header(options);
+  create_initial_edge();
 }
 
-void grapht::check_create_new_thread(BigInt thread_id, nodet *prev_node)
+void grapht::check_create_new_thread(BigInt thread_id)
 {
   if (
     std::find(std::begin(this->threads), std::end(this->threads), thread_id) ==
     std::end(this->threads))
   {
     this->threads.push_back(thread_id);
-    nodet *new_node = new nodet();
-    edget *new_edge = new edget();
-    new_edge->create_thread = integer2string(thread_id);
-    new_edge->from_node = prev_node;
-    new_edge->to_node = new_node;
-    this->edges.push_back(*new_edge);
-    prev_node = new_node;
+    nodet new_node;
+    edget new_edge(last_node(), &new_node);
+    new_edge.create_thread = integer2string(thread_id);
+    add_edge(new_edge);
   }
 }
 
 void grapht::create_initial_edge()
 {
-  nodet *first_node = new nodet();
-  first_node->entry = true;
-  nodet *initial_node = new nodet();
-  ;
-  edget first_edge(first_node, initial_node);
+  nodet first_node;
+  first_node.entry = true;
+  nodet initial_node;
+  edget first_edge(&first_node, &initial_node);
   first_edge.enter_function = "main";
   first_edge.create_thread = std::to_string(0);
   this->threads.push_back(0);
-  this->edges.push_back(first_edge);
+  add_edge(first_edge);
 }
 
 int generate_sha1_hash_for_file(const char *path, std::string &output)
@@ -128,402 +100,221 @@ std::string trim(const std::string &str)
   return str.substr(first_non_whitespace, length);
 }
 
-void create_node_node(nodet &node, xmlnodet &nodenode)
+/* Escape text as boost's XML writer does, so that witnesses stay byte for
+ * byte the same as those written through a property tree. */
+static std::string xml_escape(const std::string &s)
 {
-  nodenode.add("<xmlattr>.id", node.id);
-  if (node.violation)
+  if (!s.empty() && s.find_first_not_of(' ') == std::string::npos)
+    return "&#32;" + s.substr(1);
+
+  std::string r;
+  r.reserve(s.size());
+  for (char c : s)
   {
-    xmlnodet data_violation;
-    data_violation.add("<xmlattr>.key", "violation");
-    data_violation.put_value("true");
-    nodenode.add_child("data", data_violation);
+    switch (c)
+    {
+    case '&':
+      r += "&amp;";
+      break;
+    case '<':
+      r += "&lt;";
+      break;
+    case '>':
+      r += "&gt;";
+      break;
+    case '"':
+      r += "&quot;";
+      break;
+    case '\'':
+      r += "&apos;";
+      break;
+    default:
+      r += c;
+    }
   }
+  return r;
+}
+
+void grapht::indent()
+{
+  if (!compact)
+    *out << std::string(2 * depth, ' ');
+}
+
+void grapht::open_element(const char *name, attrst attrs, bool empty)
+{
+  indent();
+  *out << "<" << name;
+  for (const auto &attr : attrs)
+    *out << " " << attr.first << "=\"" << xml_escape(attr.second) << "\"";
+  *out << (empty ? "/>" : ">");
+  if (!compact)
+    *out << "\n";
+  if (!empty)
+    depth++;
+}
+
+void grapht::close_element(const char *name)
+{
+  depth--;
+  indent();
+  *out << "</" << name << ">";
+  if (!compact)
+    *out << "\n";
+}
+
+void grapht::data_element(const char *key, const std::string &value)
+{
+  indent();
+  *out << "<data key=\"" << key << "\">" << xml_escape(value) << "</data>";
+  if (!compact)
+    *out << "\n";
+}
+
+void grapht::write_node(const nodet &node)
+{
+  bool empty = !node.violation && !node.sink && !node.entry &&
+               !node.cycle_head && node.invariant.empty() &&
+               node.invariant_scope.empty();
+
+  open_element("node", {{"id", node.id}}, empty);
+  if (empty)
+    return;
+
+  if (node.violation)
+    data_element("violation", "true");
   if (node.sink)
-  {
-    xmlnodet data_sink;
-    data_sink.add("<xmlattr>.key", "sink");
-    data_sink.put_value("true");
-    nodenode.add_child("data", data_sink);
-  }
+    data_element("sink", "true");
   if (node.entry)
-  {
-    xmlnodet data_entry;
-    data_entry.add("<xmlattr>.key", "entry");
-    data_entry.put_value("true");
-    nodenode.add_child("data", data_entry);
-  }
+    data_element("entry", "true");
   if (node.cycle_head)
-  {
-    xmlnodet data_cycle_head;
-    data_cycle_head.add("<xmlattr>.key", "cyclehead");
-    data_cycle_head.put_value("true");
-    nodenode.add_child("data", data_cycle_head);
-  }
+    data_element("cyclehead", "true");
   if (!node.invariant.empty())
-  {
-    xmlnodet data_invariant;
-    data_invariant.add("<xmlattr>.key", "invariant");
-    data_invariant.put_value(node.invariant);
-    nodenode.add_child("data", data_invariant);
-  }
+    data_element("invariant", node.invariant);
   if (!node.invariant_scope.empty())
-  {
-    xmlnodet data_invariant;
-    data_invariant.add("<xmlattr>.key", "invariant.scope");
-    data_invariant.put_value(node.invariant_scope);
-    nodenode.add_child("data", data_invariant);
-  }
+    data_element("invariant.scope", node.invariant_scope);
+  close_element("node");
 }
 
-void create_edge_node(edget &edge, xmlnodet &edgenode)
+void grapht::add_edge(const edget &edge)
 {
-  edgenode.add("<xmlattr>.id", edge.id);
-  edgenode.add("<xmlattr>.source", edge.from_node->id);
-  edgenode.add("<xmlattr>.target", edge.to_node->id);
+  if (!last || last->id != edge.from_node->id)
+    write_node(*edge.from_node);
+  write_node(*edge.to_node);
+
+  open_element(
+    "edge",
+    {{"id", edge.id},
+     {"source", edge.from_node->id},
+     {"target", edge.to_node->id}});
   if (edge.start_line != c_nonset)
-  {
-    xmlnodet data_lineNumberInOrigin;
-    data_lineNumberInOrigin.add("<xmlattr>.key", "startline");
-    data_lineNumberInOrigin.put_value(integer2string(edge.start_line));
-    edgenode.add_child("data", data_lineNumberInOrigin);
-  }
+    data_element("startline", integer2string(edge.start_line));
   if (edge.end_line != c_nonset)
-  {
-    xmlnodet data_endLine;
-    data_endLine.add("<xmlattr>.key", "endline");
-    data_endLine.put_value(integer2string(edge.end_line));
-    edgenode.add_child("data", data_endLine);
-  }
+    data_element("endline", integer2string(edge.end_line));
   if (edge.start_offset != c_nonset)
-  {
-    xmlnodet data_startoffset;
-    data_startoffset.add("<xmlattr>.key", "startoffset");
-    data_startoffset.put_value(integer2string(edge.start_offset));
-    edgenode.add_child("data", data_startoffset);
-  }
+    data_element("startoffset", integer2string(edge.start_offset));
   if (edge.end_offset != c_nonset)
-  {
-    xmlnodet data_endoffset;
-    data_endoffset.add("<xmlattr>.key", "endoffset");
-    data_endoffset.put_value(integer2string(edge.end_offset));
-    edgenode.add_child("data", data_endoffset);
-  }
+    data_element("endoffset", integer2string(edge.end_offset));
   if (!edge.return_from_function.empty())
-  {
-    xmlnodet data_returnFromFunction;
-    data_returnFromFunction.add("<xmlattr>.key", "returnFromFunction");
-    data_returnFromFunction.put_value(edge.return_from_function);
-    edgenode.add_child("data", data_returnFromFunction);
-  }
+    data_element("returnFromFunction", edge.return_from_function);
   if (!edge.enter_function.empty())
-  {
-    xmlnodet data_enterFunction;
-    data_enterFunction.add("<xmlattr>.key", "enterFunction");
-    data_enterFunction.put_value(edge.enter_function);
-    edgenode.add_child("data", data_enterFunction);
-  }
+    data_element("enterFunction", edge.enter_function);
   if (!edge.assumption.empty())
-  {
-    xmlnodet data_assumption;
-    data_assumption.add("<xmlattr>.key", "assumption");
-    data_assumption.put_value(edge.assumption);
-    edgenode.add_child("data", data_assumption);
-  }
+    data_element("assumption", edge.assumption);
   if (!edge.assumption_scope.empty())
-  {
-    xmlnodet data_assumptionScope;
-    data_assumptionScope.add("<xmlattr>.key", "assumption.scope");
-    data_assumptionScope.put_value(edge.assumption_scope);
-    edgenode.add_child("data", data_assumptionScope);
-  }
+    data_element("assumption.scope", edge.assumption_scope);
   if (!edge.thread_id.empty())
-  {
-    xmlnodet data_thread_id;
-    data_thread_id.add("<xmlattr>.key", "threadId");
-    data_thread_id.put_value(edge.thread_id);
-    edgenode.add_child("data", data_thread_id);
-  }
+    data_element("threadId", edge.thread_id);
   if (!edge.create_thread.empty())
-  {
-    xmlnodet data_create_thread;
-    data_create_thread.add("<xmlattr>.key", "createThread");
-    data_create_thread.put_value(edge.create_thread);
-    edgenode.add_child("data", data_create_thread);
-  }
+    data_element("createThread", edge.create_thread);
+  close_element("edge");
+
+  // edge.from_node may be the last node itself, so only update it now
+  last = *edge.to_node;
 }
 
-void create_graphml(xmlnodet &graphml)
+void grapht::close()
 {
-  graphml.add(
-    "graphml.<xmlattr>.xmlns", "http://graphml.graphdrawing.org/xmlns");
-  graphml.add(
-    "graphml.<xmlattr>.xmlns:xsi", "http://www.w3.org/2001/XMLSchema-instance");
-
-  xmlnodet frontier_node;
-  frontier_node.add("<xmlattr>.id", "frontier");
-  frontier_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.name", '|'), "isFrontierNode");
-  frontier_node.put(xmlnodet::path_type("<xmlattr>|attr.type", '|'), "boolean");
-  frontier_node.add("<xmlattr>.for", "node");
-  xmlnodet frontier_default_node;
-  frontier_default_node.put_value("false");
-  frontier_node.add_child("default", frontier_default_node);
-  graphml.add_child("graphml.key", frontier_node);
-
-  xmlnodet violation_node;
-  violation_node.add("<xmlattr>.id", "violation");
-  violation_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.name", '|'), "isViolationNode");
-  violation_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.type", '|'), "boolean");
-  violation_node.add("<xmlattr>.for", "node");
-  xmlnodet violation_default_node;
-  violation_default_node.put_value("false");
-  violation_node.add_child("default", violation_default_node);
-  graphml.add_child("graphml.key", violation_node);
-
-  xmlnodet entry_node;
-  entry_node.add("<xmlattr>.id", "entry");
-  entry_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.name", '|'), "isEntryNode");
-  entry_node.put(xmlnodet::path_type("<xmlattr>|attr.type", '|'), "boolean");
-  entry_node.add("<xmlattr>.for", "node");
-  xmlnodet entry_default_node;
-  entry_default_node.put_value("false");
-  entry_node.add_child("default", entry_default_node);
-  graphml.add_child("graphml.key", entry_node);
-
-  xmlnodet sink_node;
-  sink_node.add("<xmlattr>.id", "sink");
-  sink_node.put(xmlnodet::path_type("<xmlattr>|attr.name", '|'), "isSinkNode");
-  sink_node.put(xmlnodet::path_type("<xmlattr>|attr.type", '|'), "boolean");
-  sink_node.add("<xmlattr>.for", "node");
-  xmlnodet sink_default_node;
-  sink_default_node.put_value("false");
-  sink_node.add_child("default", sink_default_node);
-  graphml.add_child("graphml.key", sink_node);
-
-  xmlnodet cycle_head_node;
-  cycle_head_node.add("<xmlattr>.id", "cyclehead");
-  cycle_head_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.name", '|'), "cyclehead");
-  cycle_head_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.type", '|'), "boolean");
-  cycle_head_node.add("<xmlattr>.for", "node");
-  xmlnodet cycle_head_default_node;
-  cycle_head_default_node.put_value("false");
-  cycle_head_node.add_child("default", cycle_head_default_node);
-  graphml.add_child("graphml.key", cycle_head_node);
-
-  xmlnodet source_code_lang_node;
-  source_code_lang_node.add("<xmlattr>.id", "sourcecodelang");
-  source_code_lang_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.name", '|'), "sourcecodeLanguage");
-  source_code_lang_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.type", '|'), "string");
-  source_code_lang_node.add("<xmlattr>.for", "graph");
-  graphml.add_child("graphml.key", source_code_lang_node);
-
-  xmlnodet program_file_node;
-  program_file_node.add("<xmlattr>.id", "programfile");
-  program_file_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.name", '|'), "programfile");
-  program_file_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.type", '|'), "string");
-  program_file_node.add("<xmlattr>.for", "graph");
-  graphml.add_child("graphml.key", program_file_node);
-
-  xmlnodet program_hash_node;
-  program_hash_node.add("<xmlattr>.id", "programhash");
-  program_hash_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.name", '|'), "programhash");
-  program_hash_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.type", '|'), "string");
-  program_hash_node.add("<xmlattr>.for", "graph");
-  graphml.add_child("graphml.key", program_hash_node);
-
-  xmlnodet creation_time_node;
-  creation_time_node.add("<xmlattr>.id", "creationtime");
-  creation_time_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.name", '|'), "creationtime");
-  creation_time_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.type", '|'), "string");
-  creation_time_node.add("<xmlattr>.for", "graph");
-  graphml.add_child("graphml.key", creation_time_node);
-
-  xmlnodet specification_node;
-  specification_node.add("<xmlattr>.id", "specification");
-  specification_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.name", '|'), "specification");
-  specification_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.type", '|'), "string");
-  specification_node.add("<xmlattr>.for", "graph");
-  graphml.add_child("graphml.key", specification_node);
-
-  xmlnodet architecture_node;
-  architecture_node.add("<xmlattr>.id", "architecture");
-  architecture_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.name", '|'), "architecture");
-  architecture_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.type", '|'), "string");
-  architecture_node.add("<xmlattr>.for", "graph");
-  graphml.add_child("graphml.key", architecture_node);
-
-  xmlnodet producer_node;
-  producer_node.add("<xmlattr>.id", "producer");
-  producer_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.name", '|'), "producer");
-  producer_node.put(xmlnodet::path_type("<xmlattr>|attr.type", '|'), "string");
-  producer_node.add("<xmlattr>.for", "graph");
-  graphml.add_child("graphml.key", producer_node);
-
-  xmlnodet source_code_node;
-  source_code_node.add("<xmlattr>.id", "sourcecode");
-  source_code_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.name", '|'), "sourcecode");
-  source_code_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.type", '|'), "string");
-  source_code_node.add("<xmlattr>.for", "edge");
-  graphml.add_child("graphml.key", source_code_node);
-
-  xmlnodet start_line_node;
-  start_line_node.add("<xmlattr>.id", "startline");
-  start_line_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.name", '|'), "startline");
-  start_line_node.put(xmlnodet::path_type("<xmlattr>|attr.type", '|'), "int");
-  start_line_node.add("<xmlattr>.for", "edge");
-  graphml.add_child("graphml.key", start_line_node);
-
-  xmlnodet start_offset_node;
-  start_offset_node.add("<xmlattr>.id", "startoffset");
-  start_offset_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.name", '|'), "startoffset");
-  start_offset_node.put(xmlnodet::path_type("<xmlattr>|attr.type", '|'), "int");
-  start_offset_node.add("<xmlattr>.for", "edge");
-  graphml.add_child("graphml.key", start_offset_node);
-
-  xmlnodet control_node;
-  control_node.add("<xmlattr>.id", "control");
-  control_node.put(xmlnodet::path_type("<xmlattr>|attr.name", '|'), "control");
-  control_node.put(xmlnodet::path_type("<xmlattr>|attr.type", '|'), "string");
-  control_node.add("<xmlattr>.for", "edge");
-  graphml.add_child("graphml.key", control_node);
-
-  xmlnodet invariant_node;
-  invariant_node.add("<xmlattr>.id", "invariant");
-  invariant_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.name", '|'), "invariant");
-  invariant_node.put(xmlnodet::path_type("<xmlattr>|attr.type", '|'), "string");
-  invariant_node.add("<xmlattr>.for", "node");
-  graphml.add_child("graphml.key", invariant_node);
-
-  xmlnodet invariant_scope_node;
-  invariant_scope_node.add("<xmlattr>.id", "invariant.scope");
-  invariant_scope_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.name", '|'), "invariant.scope");
-  invariant_scope_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.type", '|'), "string");
-  invariant_scope_node.add("<xmlattr>.for", "node");
-  graphml.add_child("graphml.key", invariant_scope_node);
-
-  xmlnodet assumption_node;
-  assumption_node.add("<xmlattr>.id", "assumption");
-  assumption_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.name", '|'), "assumption");
-  assumption_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.type", '|'), "string");
-  assumption_node.add("<xmlattr>.for", "edge");
-  graphml.add_child("graphml.key", assumption_node);
-
-  xmlnodet assumption_scope_node;
-  assumption_scope_node.add("<xmlattr>.id", "assumption.scope");
-  assumption_scope_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.name", '|'), "assumption");
-  assumption_scope_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.type", '|'), "string");
-  assumption_scope_node.add("<xmlattr>.for", "edge");
-  graphml.add_child("graphml.key", assumption_scope_node);
-
-  xmlnodet assumption_result_function_node;
-  assumption_result_function_node.add(
-    "<xmlattr>.id", "assumption.resultfunction");
-  assumption_result_function_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.name", '|'),
-    "assumption.resultfunction");
-  assumption_result_function_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.type", '|'), "string");
-  assumption_result_function_node.add("<xmlattr>.for", "edge");
-  graphml.add_child("graphml.key", assumption_result_function_node);
-
-  xmlnodet enter_function_node;
-  enter_function_node.add("<xmlattr>.id", "enterFunction");
-  enter_function_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.name", '|'), "enterFunction");
-  enter_function_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.type", '|'), "string");
-  enter_function_node.add("<xmlattr>.for", "edge");
-  graphml.add_child("graphml.key", enter_function_node);
-
-  xmlnodet return_from_function_node;
-  return_from_function_node.add("<xmlattr>.id", "returnFromFunction");
-  return_from_function_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.name", '|'), "returnFromFunction");
-  return_from_function_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.type", '|'), "string");
-  return_from_function_node.add("<xmlattr>.for", "edge");
-  graphml.add_child("graphml.key", return_from_function_node);
-
-  xmlnodet end_line_node;
-  end_line_node.add("<xmlattr>.id", "endline");
-  end_line_node.put(xmlnodet::path_type("<xmlattr>|attr.name", '|'), "endline");
-  end_line_node.put(xmlnodet::path_type("<xmlattr>|attr.type", '|'), "int");
-  end_line_node.add("<xmlattr>.for", "edge");
-  graphml.add_child("graphml.key", end_line_node);
-
-  xmlnodet end_offset_node;
-  end_offset_node.add("<xmlattr>.id", "endoffset");
-  end_offset_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.name", '|'), "endoffset");
-  end_offset_node.put(xmlnodet::path_type("<xmlattr>|attr.type", '|'), "int");
-  end_offset_node.add("<xmlattr>.for", "edge");
-  graphml.add_child("graphml.key", end_offset_node);
-
-  xmlnodet thread_id_node;
-  thread_id_node.add("<xmlattr>.id", "threadId");
-  thread_id_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.name", '|'), "threadId");
-  thread_id_node.put(xmlnodet::path_type("<xmlattr>|attr.type", '|'), "string");
-  thread_id_node.add("<xmlattr>.for", "edge");
-  graphml.add_child("graphml.key", thread_id_node);
-
-  xmlnodet create_thread_node;
-  create_thread_node.add("<xmlattr>.id", "createThread");
-  create_thread_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.name", '|'), "createThread");
-  create_thread_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.type", '|'), "string");
-  create_thread_node.add("<xmlattr>.for", "edge");
-  graphml.add_child("graphml.key", create_thread_node);
-
-  xmlnodet witness_type_node;
-  witness_type_node.add("<xmlattr>.id", "witness-type");
-  witness_type_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.name", '|'), "witness-type");
-  witness_type_node.put(
-    xmlnodet::path_type("<xmlattr>|attr.type", '|'), "string");
-  witness_type_node.add("<xmlattr>.for", "graph");
-  graphml.add_child("graphml.key", witness_type_node);
+  close_element("graph");
+  close_element("graphml");
+  out->flush();
+  if (file.is_open())
+    file.close();
 }
 
-void _create_graph_node(
-  std::string &verifiedfile,
-  optionst &options,
-  xmlnodet &graphnode)
+void grapht::write_header(optionst &options)
 {
-  graphnode.add("<xmlattr>.edgedefault", "directed");
+  *out << "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n";
+  open_element(
+    "graphml",
+    {{"xmlns", "http://graphml.graphdrawing.org/xmlns"},
+     {"xmlns:xsi", "http://www.w3.org/2001/XMLSchema-instance"}});
+
+  // The keys used in the witness: id, name, type, domain and, for the node
+  // flags, their default
+  static const struct
+  {
+    const char *id;
+    const char *name;
+    const char *type;
+    const char *domain;
+    const char *default_value;
+  } keys[] = {
+    {"frontier", "isFrontierNode", "boolean", "node", "false"},
+    {"violation", "isViolationNode", "boolean", "node", "false"},
+    {"entry", "isEntryNode", "boolean", "node", "false"},
+    {"sink", "isSinkNode", "boolean", "node", "false"},
+    {"cyclehead", "cyclehead", "boolean", "node", "false"},
+    {"sourcecodelang", "sourcecodeLanguage", "string", "graph", nullptr},
+    {"programfile", "programfile", "string", "graph", nullptr},
+    {"programhash", "programhash", "string", "graph", nullptr},
+    {"creationtime", "creationtime", "string", "graph", nullptr},
+    {"specification", "specification", "string", "graph", nullptr},
+    {"architecture", "architecture", "string", "graph", nullptr},
+    {"producer", "producer", "string", "graph", nullptr},
+    {"sourcecode", "sourcecode", "string", "edge", nullptr},
+    {"startline", "startline", "int", "edge", nullptr},
+    {"startoffset", "startoffset", "int", "edge", nullptr},
+    {"control", "control", "string", "edge", nullptr},
+    {"invariant", "invariant", "string", "node", nullptr},
+    {"invariant.scope", "invariant.scope", "string", "node", nullptr},
+    {"assumption", "assumption", "string", "edge", nullptr},
+    {"assumption.scope", "assumption", "string", "edge", nullptr},
+    {"assumption.resultfunction",
+     "assumption.resultfunction",
+     "string",
+     "edge",
+     nullptr},
+    {"enterFunction", "enterFunction", "string", "edge", nullptr},
+    {"returnFromFunction", "returnFromFunction", "string", "edge", nullptr},
+    {"endline", "endline", "int", "edge", nullptr},
+    {"endoffset", "endoffset", "int", "edge", nullptr},
+    {"threadId", "threadId", "string", "edge", nullptr},
+    {"createThread", "createThread", "string", "edge", nullptr},
+    {"witness-type", "witness-type", "string", "graph", nullptr},
+  };
 
-  xmlnodet pProducer;
-  pProducer.add("<xmlattr>.key", "producer");
+  for (const auto &key : keys)
+  {
+    bool empty = key.default_value == nullptr;
+    open_element(
+      "key",
+      {{"id", key.id},
+       {"attr.name", key.name},
+       {"attr.type", key.type},
+       {"for", key.domain}},
+      empty);
+    if (empty)
+      continue;
+
+    indent();
+    *out << "<default>" << key.default_value << "</default>";
+    if (!compact)
+      *out << "\n";
+    close_element("key");
+  }
+
+  open_element("graph", {{"edgedefault", "directed"}});
 
   std::string producer = options.get_option("witness-producer");
   if (producer.empty())
@@ -538,62 +329,38 @@ void _create_graph_node(
     else if (options.get_bool_option("incremental-bmc"))
       producer += " incr";
   }
+  data_element("producer", producer);
 
-  pProducer.put_value(producer);
-
-  graphnode.add_child("data", pProducer);
-
-  xmlnodet pSourceCodeLang;
-  pSourceCodeLang.add("<xmlattr>.key", "sourcecodelang");
-  pSourceCodeLang.put_value("C");
-  graphnode.add_child("data", pSourceCodeLang);
-
-  xmlnodet pArchitecture;
-  pArchitecture.add("<xmlattr>.key", "architecture");
-  pArchitecture.put_value(std::to_string(config.ansi_c.word_size) + "bit");
-  graphnode.add_child("data", pArchitecture);
+  data_element("sourcecodelang", "C");
+  data_element(
+    "architecture", std::to_string(config.ansi_c.word_size) + "bit");
 
-  xmlnodet pProgramFile;
-  pProgramFile.add("<xmlattr>.key", "programfile");
   std::string program_file = options.get_option("witness-programfile");
   if (program_file.empty())
-    pProgramFile.put_value(verifiedfile);
-  else
-    pProgramFile.put_value(program_file);
-  graphnode.add_child("data", pProgramFile);
+    program_file = verified_file;
+  data_element("programfile", program_file);
 
   std::string programFileHash;
-  if (program_file.empty())
-    generate_sha1_hash_for_file(verifiedfile.c_str(), programFileHash);
-  else
-    generate_sha1_hash_for_file(program_file.c_str(), programFileHash);
-  xmlnodet pProgramHash;
-  pProgramHash.add("<xmlattr>.key", "programhash");
-  pProgramHash.put_value(programFileHash);
-  graphnode.add_child("data", pProgramHash);
-
-  xmlnodet pDataSpecification;
-  pDataSpecification.add("<xmlattr>.key", "specification");
+  generate_sha1_hash_for_file(program_file.c_str(), programFileHash);
+  data_element("programhash", programFileHash);
+
+  std::string specification;
   if (options.get_bool_option("overflow-check"))
-    pDataSpecification.put_value("CHECK( init(main()), LTL(G ! overflow) )");
+    specification = "CHECK( init(main()), LTL(G ! overflow) )";
   else if (options.get_bool_option("memory-leak-check"))
   {
     if (options.get_bool_option("no-reachable-memory-leak"))
-      pDataSpecification.put_value(
-        "CHECK( init(main()), LTL(G valid-free|valid-deref|valid-memtrack) )");
+      specification =
+        "CHECK( init(main()), LTL(G valid-free|valid-deref|valid-memtrack) )";
     else
-      pDataSpecification.put_value(
-        "CHECK( init(main()), LTL(G valid-memcleanup) )");
+      specification = "CHECK( init(main()), LTL(G valid-memcleanup) )";
   }
   else
-    pDataSpecification.put_value(
-      "CHECK( init(main()), LTL(G ! call(__VERIFIER_error())) )");
-  graphnode.add_child("data", pDataSpecification);
+    specification = "CHECK( init(main()), LTL(G ! call(__VERIFIER_error())) )";
+  data_element("specification", specification);
 
   boost::posix_time::ptime creation_time =
     boost::posix_time::microsec_clock::universal_time();
-  xmlnodet p_creationTime;
-  p_creationTime.add("<xmlattr>.key", "creationtime");
 
   // Conversion to string using the ISO 8601.
   // Source: https://www.boost.org/doc/libs/1_49_0/doc/html/date_time/posix_time.html
@@ -602,33 +369,11 @@ void _create_graph_node(
   // where the seconds field is written as SS instead of SS.fffffffff
   // Here we want to make the witness validators happy.
   // source: https://github.com/sosy-lab/sv-witnesses
-  std::string new_creation_time = tmp.substr(0, tmp.find(".", 0));
-  p_creationTime.put_value(new_creation_time);
-  graphnode.add_child("data", p_creationTime);
-}
+  data_element("creationtime", tmp.substr(0, tmp.find(".", 0)));
 
-void create_violation_graph_node(
-  std::string &verifiedfile,
-  optionst &options,
-  xmlnodet &graphnode)
-{
-  _create_graph_node(verifiedfile, options, graphnode);
-  xmlnodet pWitnessType;
-  pWitnessType.add("<xmlattr>.key", "witness-type");
-  pWitnessType.put_value("violation_witness");
-  graphnode.add_child("data", pWitnessType);
-}
-
-void create_correctness_graph_node(
-  std::string &verifiedfile,
-  optionst &options,
-  xmlnodet &graphnode)
-{
-  _create_graph_node(verifiedfile, options, graphnode);
-  xmlnodet pWitnessType;
-  pWitnessType.add("<xmlattr>.key", "witness-type");
-  pWitnessType.put_value("correctness_witness");
-  graphnode.add_child("data", pWitnessType);
+  data_element(
+    "witness-type",
+    witness_type == VIOLATION ? "violation_witness" : "correctness_witness");
 }
 
 static const std::regex
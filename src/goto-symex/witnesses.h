@@ -3,6 +3,8 @@
 #include <irep2/irep2.h>
 #include <langapi/language_util.h>
 #include <goto-symex/goto_trace.h>
+#include <fstream>
+#include <optional>
 #include <string>
 #include <regex>
 #include <big-int/bigint.hh>
@@ -69,12 +71,11 @@ public:
   }
 };
 
+/* A GraphML witness, written out while it is being built: every edge is
+ * written together with the nodes it connects as soon as it is added, so
+ * neither the trace's nodes nor an XML tree are kept in memory. */
 class grapht
 {
-private:
-  std::vector<BigInt> threads;
-  void create_initial_edge();
-
 public:
   enum typet
   {
@@ -83,55 +84,45 @@ public:
   };
   typet witness_type;
   std::string verified_file;
-  std::vector<edget> edges;
-  grapht(typet t)
+
+  /// Start the witness for verified_file at the destination given by
+  /// --witness-output, with the initial edge entering main().
+  grapht(typet t, const std::string &verified_file, optionst &options);
+
+  /// The node the next edge has to start from, i.e. the target of the last
+  /// edge that was added.
+  nodet *last_node()
   {
-    witness_type = t;
-    create_initial_edge();
+    return &*last;
   }
-  void generate_graphml(optionst &options);
-  void check_create_new_thread(BigInt thread_id, nodet *prev_node);
-};
 
-/**
- * Create a GraphML node, which is the most external
- * one and includes graph, edges, and nodes.
- */
-void create_graphml(xmlnodet &graphml);
+  /// Write an edge and the nodes it connects. The graph keeps no reference to
+  /// either, they may be discarded afterwards.
+  void add_edge(const edget &edge);
+  void check_create_new_thread(BigInt thread_id);
 
-/**
- * Create a violation graph node.
- *
- * This node contains all edges and vertexes
- * of the GraphML requested by SVCOMP.
- */
-void create_violation_graph_node(
-  std::string &verifiedfile,
-  optionst &options,
-  xmlnodet &graphnode);
+  /// Finish the document.
+  void close();
 
-/**
- * Create a correctness graph node.
- *
- * See create_violation_graph_node().
- */
-void create_correctness_graph_node(
-  std::string &verifiedfile,
-  optionst &options,
-  xmlnodet &graphnode);
+private:
+  std::vector<BigInt> threads;
+  std::ofstream file;
+  std::ostream *out;
+  bool compact;
+  unsigned depth = 0;
+  std::optional<nodet> last;
 
-/**
- * Create a edge node.
- *
- * This node contains information about
- * lines, offsets, assumptions, invariants, and etc.
- */
-void create_edge_node(edget &edge, xmlnodet &edgenode);
+  void create_initial_edge();
 
-/**
- * Create a node node.
- */
-void create_node_node(nodet &node, xmlnodet &nodenode);
+  typedef std::initializer_list<std::pair<const char *, std::string>> attrst;
+  void indent();
+  void open_element(const char *name, attrst attrs, bool empty = false);
+  void close_element(const char *name);
+  void data_element(const char *key, const std::string &value);
+
+  void write_header(optionst &options);
+  void write_node(const nodet &node);
+};
 
 /**
  * This function checks if the current counterexample step
@@ -27,6 +27,7 @@
 #include <boost/preprocessor/list/for_each.hpp>
 #include <cstdarg>
 #include <functional>
+#include <type_traits>
 #include <util/compiler_defs.h>
 #include <util/crypto_hash.h>
 #include <util/dstring.h>
@@ -257,6 +258,8 @@ public:
     detach();
     T *tmp = std::shared_ptr<T>::get();
     tmp->crc_val = 0;
+    if constexpr (std::is_same_v<T, expr2t>)
+      tmp->simplified = false;
     return tmp;
   }
 
@@ -305,6 +308,10 @@ public:
 
   irep_container simplify() const
   {
+    // Shared expressions are the ones likely to be simplified again
+    if (this->use_count() > 1)
+      return simplify_shared(*this);
+
     const T *foo = get();
     return foo->simplify();
   }
@@ -787,6 +794,12 @@ public:
    */
   expr2tc simplify() const;
 
+protected:
+  /** The simplification itself, without checking or setting simplified. */
+  expr2tc simplify_once() const;
+
+public:
+
   /** expr-specific simplification methods.
    *  By default, an expression can't be simplified, and this method returns
    *  a nil expression to show that. However if simplification is possible, the
@@ -855,8 +868,24 @@ public:
   type2tc type;
 
   mutable size_t crc_val;
+
+  /** Set once simplify() found nothing to simplify in this expr, so that it
+   *  returns straight away the next time. Like crc_val, it is reset whenever
+   *  the expr is fetched for modification. */
+  mutable bool simplified;
 };
 
+/** Simplify an expression that is shared with others.
+ *  Same as expr->simplify(), but the result is remembered by node, so that
+ *  simplifying the same node again, e.g. a subterm shared by the branches of
+ *  an ITE chain, costs a lookup. The cache is per thread and only lives until
+ *  the outermost simplification running on the thread returns, so it pins
+ *  no node afterwards.
+ *  @return Either a nil expr if nothing could be simplified or a simplified
+ *          expression.
+ */
+expr2tc simplify_shared(const expr2tc &expr);
+
 inline bool is_nil_expr(const expr2tc &exp)
 {
   return exp.get() == nullptr;
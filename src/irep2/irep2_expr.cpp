@@ -122,12 +122,15 @@ static_assert(
 /*************************** Base expr2t definitions **************************/
 
 expr2t::expr2t(const type2tc &_type, expr_ids id)
-  : expr_id(id), type(_type), crc_val(0)
+  : expr_id(id), type(_type), crc_val(0), simplified(false)
 {
 }
 
 expr2t::expr2t(const expr2t &ref)
-  : expr_id(ref.expr_id), type(ref.type), crc_val(ref.crc_val)
+  : expr_id(ref.expr_id),
+    type(ref.type),
+    crc_val(ref.crc_val),
+    simplified(ref.simplified)
 {
 }
 
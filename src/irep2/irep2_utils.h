@@ -292,7 +292,9 @@ inline const type2tc &get_base_array_subtype(const type2tc &type)
 
 inline bool simplify(expr2tc &expr)
 {
-  expr2tc tmp = expr->simplify();
+  // Through the container: fetching the expr for modification would detach
+  // it, only to find there is nothing to simplify
+  expr2tc tmp = expr.simplify();
   if (!is_nil_expr(tmp))
   {
     expr = tmp;
@@ -1,7 +1,11 @@
+#include <algorithm>
+#include <atomic>
 #include <fstream>
 #include <langapi/language_ui.h>
 #include <langapi/mode.h>
 #include <memory>
+#include <thread>
+#include <util/config.h>
 #include <util/i2string.h>
 #include <util/message.h>
 #include <util/show_symbol_table.h>
@@ -35,22 +39,52 @@ language_uit &language_uit::operator=(language_uit &&o) noexcept
 
 bool language_uit::parse(const cmdlinet &cmdline)
 {
+  // Runs of consecutive files in the same language whose frontend allows it
+  // are parsed concurrently; files are still parsed in command-line order.
+  std::vector<language_filet *> concurrent;
+  language_idt concurrent_lang = language_idt::NONE;
   for (const auto &arg : cmdline.args)
   {
-    if (parse(arg))
+    if (language_id_by_path(arg) != concurrent_lang)
+    {
+      if (parse_concurrently(concurrent))
+        return true;
+      concurrent.clear();
+    }
+
+    language_filet *lf = add_file(arg);
+    if (!lf)
       return true;
+
+    if (lf->language->thread_safe_parse())
+    {
+      concurrent.push_back(lf);
+      concurrent_lang = config.language;
+      continue;
+    }
+
+    if (parse_concurrently(concurrent) || parse(*lf))
+      return true;
+    concurrent.clear();
+    concurrent_lang = language_idt::NONE;
   }
 
-  return false;
+  return parse_concurrently(concurrent);
 }
 
 bool language_uit::parse(const std::string &filename)
+{
+  language_filet *lf = add_file(filename);
+  return !lf || parse(*lf);
+}
+
+language_filet *language_uit::add_file(const std::string &filename)
 {
   language_idt lang = language_id_by_path(filename);
   if (lang == language_idt::NONE)
   {
     log_error("failed to figure out type of file {}", filename);
-    return true;
+    return nullptr;
   }
 
   config.language = lang;
@@ -60,11 +94,9 @@ bool language_uit::parse(const std::string &filename)
   if (!infile)
   {
     log_error("failed to open input file {}", filename);
-    return true;
+    return nullptr;
   }
 
-  log_progress("Parsing {}", filename);
-
   std::pair<language_filest::filemapt::iterator, bool> result =
     language_files.filemap.emplace(
       std::piecewise_construct,
@@ -81,11 +113,17 @@ bool language_uit::parse(const std::string &filename)
       "{}frontend for {} was not built on this version of ESBMC",
       config.options.get_bool_option("old-frontend") ? "old-" : "",
       language_name(lang));
-    return true;
+    return nullptr;
   }
-  languaget &language = *lf.language;
 
-  if (language.parse(filename))
+  return &lf;
+}
+
+bool language_uit::parse(language_filet &lf)
+{
+  log_progress("Parsing {}", lf.filename);
+
+  if (lf.language->parse(lf.filename))
   {
     log_error("PARSING ERROR");
     return true;
@@ -96,6 +134,68 @@ bool language_uit::parse(const std::string &filename)
   return false;
 }
 
+bool language_uit::parse_concurrently(
+  const std::vector<language_filet *> &files)
+{
+  unsigned jobs = std::thread::hardware_concurrency();
+  const std::string parse_jobs = config.options.get_option("parse-jobs");
+  if (!parse_jobs.empty())
+    jobs = atoi(parse_jobs.c_str());
+  jobs = std::min<size_t>(std::max(jobs, 1u), files.size());
+
+  if (jobs <= 1)
+  {
+    for (language_filet *lf : files)
+      if (parse(*lf))
+        return true;
+    return false;
+  }
+
+  for (language_filet *lf : files)
+    log_progress("Parsing {}", lf->filename);
+
+  // Each worker takes the next file not yet taken
+  std::atomic<size_t> next(0);
+  std::vector<char> failed(files.size(), false);
+  std::vector<std::exception_ptr> errors(files.size());
+  auto worker = [&]() {
+    for (size_t i; (i = next++) < files.size();)
+    {
+      try
+      {
+        failed[i] = files[i]->language->parse(files[i]->filename);
+      }
+      catch (...)
+      {
+        errors[i] = std::current_exception();
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (unsigned i = 0; i < jobs; i++)
+    threads.emplace_back(worker);
+  for (std::thread &t : threads)
+    t.join();
+
+  // Report in the order of the command line, as parsing sequentially would
+  for (size_t i = 0; i < files.size(); i++)
+  {
+    if (errors[i])
+      std::rethrow_exception(errors[i]);
+
+    if (failed[i])
+    {
+      log_error("PARSING ERROR");
+      return true;
+    }
+
+    files[i]->get_modules();
+  }
+
+  return false;
+}
+
 bool language_uit::typecheck()
 {
   log_progress("Converting");
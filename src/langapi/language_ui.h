@@ -30,6 +30,13 @@ public:
   virtual void show_symbol_table_xml_ui();
 
 protected:
+  /// Register \p filename in language_files and create its frontend. Returns
+  /// nullptr on error.
+  language_filet *add_file(const std::string &filename);
+  bool parse(language_filet &lf);
+  /// Parse \p files on up to --parse-jobs threads.
+  bool parse_concurrently(const std::vector<language_filet *> &files);
+
   /* The instance of this class manages the global migrate_namespace_lookup,
    * thus it cannot be copied. These functions are protected in order for
    * derived classes to opt-into move support. */
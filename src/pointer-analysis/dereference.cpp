@@ -1,7 +1,9 @@
+#include <boost/functional/hash.hpp>
 #include <cassert>
 #include <langapi/language_util.h>
 #include <pointer-analysis/dereference.h>
 #include <pointer-analysis/value_set.h>
+#include <optional>
 #include <sstream>
 #include <util/arith_tools.h>
 #include <util/array_name.h>
@@ -16,12 +18,16 @@
 #include <irep2/irep2.h>
 #include <util/message/format.h>
 #include <util/migrate.h>
+#include <util/perf_report.h>
 #include <util/prefix.h>
 #include <util/pretty.h>
 #include <util/rename.h>
 #include <util/std_expr.h>
 #include <util/type_byte_size.h>
 
+static perf_countert cache_lookups("dereference-cache-lookups");
+static perf_countert cache_hits("dereference-cache-hits");
+
 // global data, horrible
 unsigned int dereferencet::invalid_counter = 0;
 
@@ -472,6 +478,33 @@ expr2tc dereferencet::dereference(
 
   dereference_callback.get_value_set(src, points_to_set);
 
+  // Reuse the reference built when the same pointer was last dereferenced
+  // like this with the same value set. INTERNAL mode only wants the latter.
+  std::optional<dereference_cachet::keyt> key;
+  if (cache && !is_internal(mode))
+  {
+    key = dereference_cachet::keyt{
+      src,
+      type,
+      lexical_offset,
+      guard.as_expr(),
+      (unsigned)mode.op << 1 | mode.unaligned,
+      block_assertions,
+      points_to_set};
+
+    cache_lookups.add();
+    const dereference_cachet::entryt *hit = cache->find(*key);
+    if (hit && replay(*hit))
+    {
+      cache_hits.add();
+      return refresh_failed_symbols(*hit);
+    }
+  }
+
+  dereference_cachet::entryt entry;
+  dereference_cachet::entryt *outer =
+    std::exchange(recording, key ? &entry : nullptr);
+
   // now build big case split
   // only "good" objects
 
@@ -532,6 +565,26 @@ expr2tc dereferencet::dereference(
     value = make_failed_symbol(type);
   }
 
+  recording = outer;
+  if (key)
+  {
+    // Whatever this encoded is also encoded by the enclosing dereference
+    if (outer)
+    {
+      outer->failures.insert(
+        outer->failures.end(), entry.failures.begin(), entry.failures.end());
+      outer->liveness.insert(
+        outer->liveness.end(), entry.liveness.begin(), entry.liveness.end());
+      outer->failed_symbols.insert(
+        outer->failed_symbols.end(),
+        entry.failed_symbols.begin(),
+        entry.failed_symbols.end());
+    }
+
+    entry.value = value;
+    cache->insert(*key, std::move(entry));
+  }
+
   return value;
 }
 
@@ -563,6 +616,9 @@ expr2tc dereferencet::make_failed_symbol(const type2tc &out_type)
   migrate_expr(symbol_expr(*s), value);
   migrate_namespace_lookup = old_ns;
 
+  if (recording)
+    recording->failed_symbols.push_back(value);
+
   return value;
 }
 
@@ -1876,7 +1932,79 @@ void dereferencet::dereference_failure(
 {
   // This just wraps dereference failure in a no-pointer-check check.
   if (!options.get_bool_option("no-pointer-check") && !block_assertions)
-    dereference_callback.dereference_failure(error_class, error_name, guard);
+    report_failure(error_class, error_name, guard);
+}
+
+void dereferencet::report_failure(
+  const std::string &error_class,
+  const std::string &error_name,
+  const guardt &guard)
+{
+  dereference_callback.dereference_failure(error_class, error_name, guard);
+  if (recording)
+    recording->failures.push_back({error_class, error_name, guard});
+}
+
+bool dereferencet::is_live_variable(const expr2tc &symbol)
+{
+  bool live = dereference_callback.is_live_variable(symbol);
+  if (recording)
+    recording->liveness.emplace_back(symbol, live);
+  return live;
+}
+
+bool dereferencet::replay(const dereference_cachet::entryt &entry)
+{
+  for (const auto &[symbol, live] : entry.liveness)
+    if (is_live_variable(symbol) != live)
+      return false;
+
+  for (const dereference_cachet::failuret &failure : entry.failures)
+    report_failure(failure.property, failure.msg, failure.guard);
+
+  return true;
+}
+
+/** The expression with the symbols that are keys of fresh replaced, sharing
+ *  every subexpression that contains none of them */
+static expr2tc replace_symbols(
+  const expr2tc &expr,
+  const std::unordered_map<expr2tc, expr2tc, irep2_hash> &fresh)
+{
+  if (is_symbol2t(expr))
+  {
+    auto it = fresh.find(expr);
+    return it == fresh.end() ? expr : it->second;
+  }
+
+  std::vector<expr2tc> operands;
+  bool changed = false;
+  expr->foreach_operand([&fresh, &operands, &changed](const expr2tc &e) {
+    operands.push_back(replace_symbols(e, fresh));
+    changed |= operands.back().get() != e.get();
+  });
+
+  if (!changed)
+    return expr;
+
+  expr2tc res = expr;
+  auto it = operands.begin();
+  res->Foreach_operand([&it](expr2tc &e) { e = *it++; });
+  return res;
+}
+
+expr2tc
+dereferencet::refresh_failed_symbols(const dereference_cachet::entryt &entry)
+{
+  if (entry.failed_symbols.empty())
+    return entry.value;
+
+  // Each dereference gets free values of its own
+  std::unordered_map<expr2tc, expr2tc, irep2_hash> fresh;
+  for (const expr2tc &sym : entry.failed_symbols)
+    fresh.emplace(sym, make_failed_symbol(sym->type));
+
+  return replace_symbols(entry.value, fresh);
 }
 
 void dereferencet::bad_base_type_failure(
@@ -2108,7 +2236,7 @@ void dereferencet::valid_check(
       // Otherwise, this is a pointer to some kind of lexical variable, with
       // either global or function-local scope. Ask symex to determine if
       // it's live.
-      if (!dereference_callback.is_live_variable(symbol))
+      if (!is_live_variable(symbol))
       {
         // Any access where this guard is true -> failure
         dereference_failure(
@@ -2415,3 +2543,46 @@ expr2tc dereferencet::extract_bits_from_byte_array(
   simplify(result);
   return result;
 }
+
+/****************************** Dereference cache *****************************/
+
+/** Hash of an expression that may be nil */
+static size_t expr_hash(const expr2tc &expr)
+{
+  return is_nil_expr(expr) ? 0 : expr.crc();
+}
+
+bool dereference_cachet::keyt::operator==(const keyt &other) const
+{
+  return mode == other.mode && block_assertions == other.block_assertions &&
+         src == other.src && type == other.type &&
+         lexical_offset == other.lexical_offset && guard == other.guard &&
+         points_to_set == other.points_to_set;
+}
+
+size_t dereference_cachet::key_hash::operator()(const keyt &key) const
+{
+  size_t h = expr_hash(key.src);
+  boost::hash_combine(h, key.type.crc());
+  boost::hash_combine(h, expr_hash(key.lexical_offset));
+  boost::hash_combine(h, key.guard.crc());
+  boost::hash_combine(h, key.mode);
+  boost::hash_combine(h, key.block_assertions);
+  for (const expr2tc &target : key.points_to_set)
+    boost::hash_combine(h, expr_hash(target));
+  return h;
+}
+
+const dereference_cachet::entryt *
+dereference_cachet::find(const keyt &key) const
+{
+  auto it = entries.find(key);
+  return it == entries.end() ? nullptr : &it->second;
+}
+
+void dereference_cachet::insert(const keyt &key, entryt entry)
+{
+  if (entries.size() >= limit)
+    entries.clear();
+  entries.insert_or_assign(key, std::move(entry));
+}
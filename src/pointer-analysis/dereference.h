@@ -3,6 +3,7 @@
 
 #include <pointer-analysis/value_sets.h>
 #include <set>
+#include <unordered_map>
 #include <util/expr.h>
 #include <util/guard.h>
 #include <util/namespace.h>
@@ -154,6 +155,70 @@ public:
   virtual bool is_live_variable(const expr2tc &sym) = 0;
 };
 
+/** Cache of the references built by dereferencet::dereference.
+ *  Dereferencing the same pointer under the same guard, with the same set of
+ *  objects it may point at, to the same type and offset, builds the same
+ *  reference and encodes the same validity and bounds assertions. Symex keeps
+ *  one of these so that each is only built once. The points-to set is part of
+ *  the key, so an entry is never found again once the value set changes.
+ *  The free values of failed accesses in a reused reference are replaced by
+ *  new ones, so that they stay unrelated to those of other dereferences.
+ *
+ *  Whether a pointer to a lexical variable is valid depends on the call stack
+ *  rather than on the value set, so the liveness answers an entry was built
+ *  with are recorded too, and the entry is only used while they still hold.
+ */
+class dereference_cachet
+{
+public:
+  struct keyt
+  {
+    expr2tc src;
+    type2tc type;
+    expr2tc lexical_offset;
+    expr2tc guard;
+    /** The access mode, see dereferencet::modet */
+    unsigned mode;
+    bool block_assertions;
+    value_setst::valuest points_to_set;
+
+    bool operator==(const keyt &other) const;
+  };
+
+  /** A dereference failure assertion, as passed to the callback */
+  struct failuret
+  {
+    std::string property;
+    std::string msg;
+    guardt guard;
+  };
+
+  struct entryt
+  {
+    expr2tc value;
+    std::vector<failuret> failures;
+    /** Lexical variables whose liveness was checked, with the answers */
+    std::vector<std::pair<expr2tc, bool>> liveness;
+    /** The free variables made for failed accesses, which are replaced by
+     *  new ones whenever the entry is used */
+    std::vector<expr2tc> failed_symbols;
+  };
+
+  /** The entry stored for key, or nullptr if there is none */
+  const entryt *find(const keyt &key) const;
+  void insert(const keyt &key, entryt entry);
+
+protected:
+  struct key_hash
+  {
+    size_t operator()(const keyt &key) const;
+  };
+
+  std::unordered_map<keyt, entryt, key_hash> entries;
+  /** The cache is dropped when it holds this many entries */
+  static const size_t limit = 1 << 14;
+};
+
 /** Class containing expression dereference logic.
  *  This class doesn't actually store any state, in that all the side-effects
  *  of what it does are either returned to the caller, or passed through the
@@ -170,16 +235,20 @@ public:
    *  @param _dereference_callback Callback object to invoke when we need
    *         external information or otherwise need to interacte with the
    *         context.
+   *  @param _cache Cache of the references built before, if any. It must
+   *         only be shared by dereferences under the same options.
    */
   dereferencet(
     const namespacet &_ns,
     contextt &_new_context,
     const optionst &_options,
-    dereference_callbackt &_dereference_callback)
+    dereference_callbackt &_dereference_callback,
+    dereference_cachet *_cache = nullptr)
     : ns(_ns),
       new_context(_new_context),
       options(_options),
       dereference_callback(_dereference_callback),
+      cache(_cache),
       block_assertions(false)
   {
     is_big_endian =
@@ -274,6 +343,11 @@ private:
   const optionst &options;
   /** The callback object to funnel all interactions with the context through.*/
   dereference_callbackt &dereference_callback;
+  /** Cache of the references built by dereference(), or nullptr. */
+  dereference_cachet *cache;
+  /** The cache entry being built by the running dereference(), which records
+   *  the assertions encoded and the liveness checks made. */
+  dereference_cachet::entryt *recording = nullptr;
   /** The number of failed symbols that we've generated (they're numbered
    *  individually. */
   static unsigned invalid_counter;
@@ -418,6 +492,22 @@ private:
     const std::string &error_class,
     const std::string &error_name,
     const guardt &guard);
+  /** Pass a failure to the callback, and record it in the cache entry being
+   *  built. */
+  void report_failure(
+    const std::string &error_class,
+    const std::string &error_name,
+    const guardt &guard);
+  /** Ask the callback whether symbol is live, and record the answer in the
+   *  cache entry being built. */
+  bool is_live_variable(const expr2tc &symbol);
+  /** Encode the assertions of a cache entry again, provided the lexical
+   *  variables it checked are still as live as they were.
+   *  @return False if they are not, in which case nothing was encoded. */
+  bool replay(const dereference_cachet::entryt &entry);
+  /** The value of a cache entry, with new failed symbols in place of those
+   *  it was built with. */
+  expr2tc refresh_failed_symbols(const dereference_cachet::entryt &entry);
   void alignment_failure(const std::string &error_name, const guardt &guard);
 
   void bad_base_type_failure(
@@ -15,18 +15,15 @@ def import_module_by_name(module_name):
 
 
 def check_usage():
+    if len(sys.argv) == 2 and sys.argv[1] == "--server":
+        return
     if len(sys.argv) != 3:
         print("Usage: python astgen.py <file path> <output directory>")
+        print("       python astgen.py --server")
         sys.exit(2)
 
 
-def main():
-    ast2json_module = import_module_by_name("ast2json")
-
-    check_usage()
-    filename = sys.argv[1]
-    output_dir = sys.argv[2]
-
+def generate(ast2json_module, filename, output_dir):
     if not os.path.exists(output_dir):
         os.makedirs(output_dir)
 
@@ -41,7 +38,46 @@ def main():
     json_filename = os.path.join(output_dir, "ast.json")
 
     with open(json_filename, "w") as json_file:
-        json.dump(ast_json, json_file, indent=4)
+        json.dump(ast_json, json_file)
+
+
+def serve():
+    # Requests are a line with the file path followed by a line with the output
+    # directory; every request is answered by a line "ok" or "error <reason>".
+    # The server only exits at the end of its input, so that ESBMC never writes
+    # to a closed pipe.
+    try:
+        ast2json_module = importlib.import_module("ast2json")
+    except ImportError:
+        ast2json_module = None
+
+    while True:
+        filename = sys.stdin.readline()
+        output_dir = sys.stdin.readline()
+        if not output_dir:
+            break
+
+        if ast2json_module is None:
+            print("error Module 'ast2json' not found, please install it with: "
+                  "pip3 install ast2json", flush=True)
+            continue
+
+        try:
+            generate(ast2json_module, filename.rstrip("\n"),
+                     output_dir.rstrip("\n"))
+            print("ok", flush=True)
+        except Exception as e:
+            message = str(e).replace("\n", " ")
+            print(f"error {type(e).__name__}: {message}", flush=True)
+
+
+def main():
+    check_usage()
+    if sys.argv[1] == "--server":
+        serve()
+    else:
+        ast2json_module = import_module_by_name("ast2json")
+        generate(ast2json_module, sys.argv[1], sys.argv[2])
 
 
 if __name__ == "__main__":
@@ -1,5 +1,4 @@
 #include <python-frontend/python_converter.h>
-#include <python-frontend/json_utils.h>
 #include <python_frontend_types.h>
 #include <util/std_code.h>
 #include <util/c_types.h>
@@ -11,8 +10,6 @@
 #include <regex>
 #include <unordered_map>
 
-using namespace json_utils;
-
 static const std::unordered_map<std::string, std::string> operator_map = {
   {"Add", "+"},         {"Sub", "-"},          {"Mult", "*"},
   {"Div", "/"},         {"Mod", "mod"},        {"BitOr", "bitor"},
@@ -85,7 +82,7 @@ typet python_converter::get_typet(const std::string &ast_type)
     return long_long_uint_type();
   if (ast_type == "bool")
     return bool_type();
-  if (is_class(ast_type, ast_json["body"]))
+  if (find_class(ast_type))
     return symbol_typet("tag-" + ast_type);
   return empty_typet();
 }
@@ -328,18 +325,32 @@ exprt python_converter::get_unary_operator_expr(const nlohmann::json &element)
   return unary_expr;
 }
 
-const nlohmann::json python_converter::find_var_decl(
+const nlohmann::json &python_converter::find_var_decl(
   const std::string &var_name,
   const nlohmann::json &json)
 {
-  for (auto &element : json["body"])
+  static const nlohmann::json not_found;
+
+  auto [scope, inserted] = var_decl_index.try_emplace(&json);
+  if (inserted)
   {
-    if (
-      element["_type"] == "AnnAssign" && element["target"].contains("id") &&
-      element["target"]["id"] == var_name)
-      return element;
+    for (const auto &element : json["body"])
+    {
+      if (element["_type"] == "AnnAssign" && element["target"].contains("id"))
+        scope->second.emplace(
+          element["target"]["id"].get<std::string>(), &element);
+    }
   }
-  return nlohmann::json();
+
+  auto it = scope->second.find(var_name);
+  return it == scope->second.end() ? not_found : *it->second;
+}
+
+const nlohmann::json *
+python_converter::find_class(const std::string &class_name) const
+{
+  auto it = class_index.find(class_name);
+  return it == class_index.end() ? nullptr : it->second;
 }
 
 locationt
@@ -366,15 +377,15 @@ symbolt *python_converter::find_function_in_base_classes(
   symbolt *func = nullptr;
 
   // Find class node in the AST
-  auto class_node = json_utils::find_class(ast_json["body"], class_name);
+  const nlohmann::json *class_node = find_class(class_name);
 
-  if (class_node != nlohmann::json())
+  if (class_node)
   {
     std::string current_class = class_name;
     std::string current_func_name = (is_ctor) ? class_name : method_name;
     std::string sym_id = symbol_id;
     // Search for method in all bases classes
-    for (const auto &base_class_node : class_node["bases"])
+    for (const auto &base_class_node : (*class_node)["bases"])
     {
       const std::string &base_class = base_class_node["id"].get<std::string>();
       if (is_ctor)
@@ -485,7 +496,7 @@ exprt python_converter::get_function_call(const nlohmann::json &element)
         else if (is_member_function_call)
         {
           // Get class name from obj annotation
-          auto obj_node = find_var_decl(obj_name, ast_json);
+          const auto &obj_node = find_var_decl(obj_name, ast_json);
           if (obj_node == nlohmann::json())
             abort();
 
@@ -621,7 +632,7 @@ exprt python_converter::get_expr(const nlohmann::json &element)
     else if (element["_type"] == "Attribute")
     {
       var_name = element["value"]["id"].get<std::string>();
-      if (is_class(var_name, ast_json["body"]))
+      if (find_class(var_name))
       {
         // Found a class attribute
         var_name = "C@" + var_name;
@@ -799,20 +810,18 @@ void python_converter::get_var_assign(
     // Get type from declaration node
     std::string var_name = ast_node["targets"][0]["id"].get<std::string>();
     // Get variable from current function
-    nlohmann::json ref;
-    for (const auto &elem : ast_json["body"])
-    {
-      if (elem["_type"] == "FunctionDef" && elem["name"] == current_func_name)
-        ref = find_var_decl(var_name, elem);
-    }
+    const nlohmann::json *ref = nullptr;
+    auto func = function_index.find(current_func_name);
+    if (func != function_index.end())
+      ref = &find_var_decl(var_name, *func->second);
 
     // Get variable from global scope
-    if (ref.empty())
-      ref = find_var_decl(var_name, ast_json);
+    if (!ref || ref->empty())
+      ref = &find_var_decl(var_name, ast_json);
 
-    assert(!ref.empty());
+    assert(!ref->empty());
     current_element_type =
-      get_typet(ref["annotation"]["id"].get<std::string>());
+      get_typet((*ref)["annotation"]["id"].get<std::string>());
   }
 
   exprt lhs;
@@ -903,8 +912,9 @@ void python_converter::get_var_assign(
 
         if (base_ctor_called)
         {
-          auto class_node = json_utils::find_class(ast_json["body"], func_name);
-          func_name = class_node["bases"][0]["id"].get<std::string>();
+          const nlohmann::json *class_node = find_class(func_name);
+          assert(class_node);
+          func_name = (*class_node)["bases"][0]["id"].get<std::string>();
           base_ctor_called = false;
         }
 
@@ -942,7 +952,7 @@ void python_converter::get_compound_assign(
 {
   // Get type from declaration node
   std::string var_name = ast_node["target"]["id"].get<std::string>();
-  nlohmann::json ref = find_var_decl(var_name, ast_json);
+  const nlohmann::json &ref = find_var_decl(var_name, ast_json);
   assert(!ref.empty());
   current_element_type = get_typet(ref["annotation"]["id"].get<std::string>());
 
@@ -1319,6 +1329,14 @@ python_converter::python_converter(
     current_class_name(""),
     ref_instance(nullptr)
 {
+  for (const auto &elem : ast_json["body"])
+  {
+    if (elem["_type"] == "ClassDef")
+      class_index.emplace(elem["name"].get<std::string>(), &elem);
+    // A function defined again replaces the previous definition
+    else if (elem["_type"] == "FunctionDef")
+      function_index[elem["name"].get<std::string>()] = &elem;
+  }
 }
 
 bool python_converter::convert()
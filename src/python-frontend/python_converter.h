@@ -33,8 +33,9 @@ private:
   exprt get_function_call(const nlohmann::json &ast_block);
   exprt get_block(const nlohmann::json &ast_block);
 
-  const nlohmann::json
+  const nlohmann::json &
   find_var_decl(const std::string &var_name, const nlohmann::json &json);
+  const nlohmann::json *find_class(const std::string &class_name) const;
   void adjust_statement_types(exprt &lhs, exprt &rhs) const;
   std::string create_symbol_id() const;
   bool is_constructor_call(const nlohmann::json &json);
@@ -69,4 +70,13 @@ private:
 
   // Map object to list of instance attributes
   std::unordered_map<std::string, std::set<std::string>> instance_attr_map;
+
+  // Classes and functions of the module by name, indexed once
+  std::unordered_map<std::string, const nlohmann::json *> class_index;
+  std::unordered_map<std::string, const nlohmann::json *> function_index;
+  // Annotated variables of each scope by name, indexed on the first lookup
+  std::unordered_map<
+    const nlohmann::json *,
+    std::unordered_map<std::string, const nlohmann::json *>>
+    var_decl_index;
 };
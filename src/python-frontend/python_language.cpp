@@ -5,9 +5,13 @@
 #include <util/message.h>
 #include <util/filesystem.h>
 #include <util/c_expr2string.h>
+#include <util/crypto_hash.h>
+#include <util/perf_report.h>
 
 #include <cstdlib>
 #include <fstream>
+#include <memory>
+#include <sstream>
 
 #include <boost/filesystem.hpp>
 #include <boost/process.hpp>
@@ -39,6 +43,134 @@ static const std::string &dump_python_script()
   return p.path();
 }
 
+namespace
+{
+/// An astgen.py process generating the ASTs of all Python inputs of a run, so
+/// that the interpreter starts and imports ast2json only once
+class astgen_servert
+{
+public:
+  explicit astgen_servert(const std::string &script)
+    : child(
+        bp::search_path("python3"),
+        script,
+        "--server",
+        bp::std_in < to,
+        bp::std_out > from),
+      owner(boost::this_process::get_id())
+  {
+  }
+
+  ~astgen_servert()
+  {
+    // The server exits once its input is closed. opstream::close() only
+    // flushes the pipe.
+    to.flush();
+    to.pipe().close();
+    std::error_code ec;
+    child.wait(ec);
+  }
+
+  /// Write the AST of file as ast.json into output_dir. Returns true and sets
+  /// error on failure.
+  bool generate(
+    const std::string &file,
+    const std::string &output_dir,
+    std::string &error)
+  {
+    to << file << '\n' << output_dir << '\n' << std::flush;
+
+    std::string reply;
+    if (!std::getline(from, reply))
+    {
+      error = "the AST generator exited";
+      return true;
+    }
+
+    if (reply == "ok")
+      return false;
+
+    error = reply.substr(reply.find(' ') + 1);
+    return true;
+  }
+
+  bool running()
+  {
+    std::error_code ec;
+    return child.running(ec);
+  }
+
+  /// Whether the server belongs to this process, rather than to the parent it
+  /// was forked from
+  bool owned() const
+  {
+    return owner == boost::this_process::get_id();
+  }
+
+protected:
+  bp::opstream to;
+  bp::ipstream from;
+  bp::child child;
+  bp::pid_t owner;
+};
+} // namespace
+
+static perf_countert ast_cache_hits("python-ast-cache-hits");
+static perf_countert ast_cache_misses("python-ast-cache-misses");
+
+static bool generate_ast(
+  const std::string &file,
+  const std::string &output_dir,
+  std::string &error)
+{
+  static std::unique_ptr<astgen_servert> server;
+  if (server && !server->owned())
+    // Its pipes are shared with the parent, leave them alone
+    server.release();
+
+  if (!server)
+    server =
+      std::make_unique<astgen_servert>(dump_python_script() + "/astgen.py");
+
+  if (!server->generate(file, output_dir, error))
+    return false;
+
+  // Start a new one for the next file if this one died
+  if (!server->running())
+    server.reset();
+  return true;
+}
+
+static std::string read_file(const std::string &path)
+{
+  std::ifstream in(path, std::ios::binary);
+  std::ostringstream contents;
+  contents << in.rdbuf();
+  return contents.str();
+}
+
+/// Key of the AST cache entry of the source file at path. ASTs depend on
+/// astgen.py and on the Python version besides the source, so the key covers
+/// the script and the interpreter it runs on.
+static std::string ast_cache_key(const std::string &path)
+{
+  static const std::string salt = [] {
+    std::string s = read_file(dump_python_script() + "/astgen.py");
+    boost::system::error_code ec;
+    fs::path python = fs::canonical(bp::search_path("python3"), ec);
+    s += '\0' + python.string() + '\0' +
+         std::to_string(fs::last_write_time(python, ec));
+    return s;
+  }();
+
+  const std::string source = read_file(path);
+  crypto_hash h;
+  h.ingest(salt.c_str(), salt.size() + 1);
+  h.ingest(source.c_str(), source.size());
+  h.fin();
+  return h.to_string();
+}
+
 languaget *new_python_language()
 {
   return new python_languaget;
@@ -52,27 +184,65 @@ bool python_languaget::parse(const std::string &path)
   if (!fs::exists(script))
     return true;
 
-  ast_output_dir = dump_python_script();
-  const std::string python_script_path = ast_output_dir + "/astgen.py";
+  std::string ast_file;
+  const std::string cache = config.options.get_option("python-ast-cache");
+  if (cache.empty())
+  {
+    ast_output_dir = dump_python_script();
+    ast_file = ast_output_dir + "/ast.json";
+    std::string error;
+    if (generate_ast(path, ast_output_dir, error))
+    {
+      log_error("Python execution failed: {}", error);
+      return true;
+    }
+  }
+  else
+  {
+    ast_output_dir = cache;
+    ast_file = (fs::path(cache) / (ast_cache_key(path) + ".json")).string();
+    if (fs::exists(ast_file))
+    {
+      ast_cache_hits.add();
+      log_status("Python AST cache: hit for {}", path);
+    }
+    else
+    {
+      ast_cache_misses.add();
+      log_status("Python AST cache: miss for {}", path);
 
-  // Execute python script to generate json file from AST
-  std::vector<std::string> args = {python_script_path, path, ast_output_dir};
+      // Generate the entry aside and move it in place, other processes may
+      // share the cache
+      fs::path tmp = fs::unique_path(ast_file + ".%%%%-%%%%.tmp");
+      fs::create_directories(tmp);
+      file_operations::tmp_path cleanup(tmp.string());
+      std::string error;
+      if (generate_ast(path, tmp.string(), error))
+      {
+        log_error("Python execution failed: {}", error);
+        return true;
+      }
 
-  // Create a child process to execute Python
-  bp::child process(bp::search_path("python3"), args);
+      std::ifstream ast_json((tmp / "ast.json").string());
+      ast = nlohmann::json::parse(ast_json);
 
-  // Wait for execution
-  process.wait();
+      boost::system::error_code ec;
+      fs::rename(tmp / "ast.json", ast_file, ec);
+      if (ec)
+        log_warning("Failed to cache the AST of {}: {}", path, ec.message());
+    }
+  }
 
-  if (process.exit_code())
+  // Parse and generate AST
+  if (ast.is_null())
   {
-    log_error("Python execution failed");
-    return true;
+    std::ifstream ast_json(ast_file);
+    ast = nlohmann::json::parse(ast_json);
   }
 
-  // Parse and generate AST
-  std::ifstream ast_json(ast_output_dir + "/ast.json");
-  ast = nlohmann::json::parse(ast_json);
+  // Sources with the same contents share their cache entry, which names the
+  // first of them
+  ast["filename"] = path;
 
   // Add annotation
   python_annotation<nlohmann::json> ann(ast);
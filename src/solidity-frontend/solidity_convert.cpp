@@ -10,6 +10,7 @@
 #include <util/std_expr.h>
 #include <util/message.h>
 #include <regex>
+#include <utility>
 
 #include <fstream>
 
@@ -55,6 +56,8 @@ bool solidity_convertert::convert()
 
   absolute_path = ast_json["absolutePath"].get<std::string>();
 
+  index_ast();
+
   // By now the context should have the symbols of all ESBMC's intrinsics and the dummy main
   // We need to convert Solidity AST nodes to the equivalent symbols and add them to the context
   nlohmann::json &nodes = ast_json["nodes"];
@@ -1573,7 +1576,7 @@ bool solidity_convertert::get_expr(
 
       const int contract_func_id =
         callee_expr_json["referencedDeclaration"].get<int>();
-      const nlohmann::json caller_expr_json = find_decl_ref(contract_func_id);
+      const nlohmann::json &caller_expr_json = find_decl_ref(contract_func_id);
       std::string ref_contract_name;
       if (get_current_contract_name(caller_expr_json, ref_contract_name))
         return true;
@@ -1655,7 +1658,7 @@ bool solidity_convertert::get_expr(
       exprt inits = gen_zero(t);
 
       int ref_id = callee_expr_json["referencedDeclaration"].get<int>();
-      const nlohmann::json struct_ref = find_decl_ref(ref_id);
+      const nlohmann::json &struct_ref = find_decl_ref(ref_id);
       const nlohmann::json members = struct_ref["members"];
       const nlohmann::json args = expr["arguments"];
 
@@ -1922,10 +1925,6 @@ bool solidity_convertert::get_expr(
     assert(expr.contains("expression"));
     const nlohmann::json callee_expr_json = expr["expression"];
 
-    const int caller_id = callee_expr_json["referencedDeclaration"].get<int>();
-
-    const nlohmann::json caller_expr_json = find_decl_ref(caller_id);
-
     switch (type)
     {
     case SolidityGrammar::ExpressionT::StructMemberCall:
@@ -1935,7 +1934,7 @@ bool solidity_convertert::get_expr(
         return true;
 
       const int struct_var_id = expr["referencedDeclaration"].get<int>();
-      const nlohmann::json struct_var_ref = find_decl_ref(struct_var_id);
+      const nlohmann::json &struct_var_ref = find_decl_ref(struct_var_id);
 
       exprt comp;
       if (get_var_decl_ref(struct_var_ref, comp))
@@ -1955,7 +1954,7 @@ bool solidity_convertert::get_expr(
     case SolidityGrammar::ExpressionT::EnumMemberCall:
     {
       const int enum_id = expr["referencedDeclaration"].get<int>();
-      const nlohmann::json enum_member_ref = find_decl_ref(enum_id);
+      const nlohmann::json &enum_member_ref = find_decl_ref(enum_id);
       if (get_enum_member_ref(enum_member_ref, new_expr))
         return true;
 
@@ -2696,6 +2695,20 @@ bool solidity_convertert::get_type_description(
   const nlohmann::json &type_name,
   typet &new_type)
 {
+  // The same descriptions come up for most declarations and expressions
+  std::string cache_key;
+  if (type_name.contains("typeString") && type_name.contains("typeIdentifier"))
+  {
+    cache_key = type_name["typeIdentifier"].get<std::string>() + "\n" +
+                type_name["typeString"].get<std::string>();
+    auto it = type_description_cache.find(cache_key);
+    if (it != type_description_cache.end())
+    {
+      new_type = it->second;
+      return false;
+    }
+  }
+
   // For Solidity rule type-name:
   SolidityGrammar::TypeNameT type = SolidityGrammar::get_type_name_t(type_name);
 
@@ -2704,7 +2717,12 @@ bool solidity_convertert::get_type_description(
   case SolidityGrammar::TypeNameT::ElementaryTypeName:
   {
     // rule state-variable-declaration
-    return get_elementary_type_name(type_name, new_type);
+    if (get_elementary_type_name(type_name, new_type))
+      return true;
+
+    if (!cache_key.empty())
+      type_description_cache.emplace(cache_key, new_type);
+    break;
   }
   case SolidityGrammar::TypeNameT::ParameterList:
   {
@@ -2783,6 +2801,8 @@ bool solidity_convertert::get_type_description(
         integer2string(z_ext_value),
         int_type()));
 
+    if (!cache_key.empty())
+      type_description_cache.emplace(cache_key, new_type);
     break;
   }
   case SolidityGrammar::TypeNameT::DynArrayTypeName:
@@ -2910,6 +2930,8 @@ bool solidity_convertert::get_type_description(
   case SolidityGrammar::TypeNameT::EnumTypeName:
   {
     new_type = enum_type();
+    if (!cache_key.empty())
+      type_description_cache.emplace(cache_key, new_type);
     break;
   }
   case SolidityGrammar::TypeNameT::StructTypeName:
@@ -2956,7 +2978,7 @@ bool solidity_convertert::get_type_description(
       auto pos_2 = typeIdentifier.find("_storage");
 
       const int ref_id = stoi(typeIdentifier.substr(pos_1 + 1, pos_2));
-      const nlohmann::json struct_base = find_decl_ref(ref_id);
+      const nlohmann::json &struct_base = find_decl_ref(ref_id);
 
       if (get_struct_class(struct_base))
         return true;
@@ -3635,204 +3657,122 @@ const nlohmann::json &solidity_convertert::find_decl_ref(int ref_decl_id)
   return find_decl_ref(ref_decl_id, empty_str);
 }
 
-const nlohmann::json &
-solidity_convertert::find_decl_ref(int ref_decl_id, std::string &contract_name)
+void solidity_convertert::index_ast()
 {
-  //TODO: Clean up this funciton. Such a mess...
-
-  if (ref_decl_id < 0)
-  {
-    log_warning("Cannot find declaration reference for the built-in function.");
-    abort();
-  }
-
-  // First, search state variable nodes
-  nlohmann::json &nodes = ast_json["nodes"];
-  unsigned index = 0;
-  for (nlohmann::json::iterator itr = nodes.begin(); itr != nodes.end();
-       ++itr, ++index)
-  {
-    // check the nodes outside of the contract
-    // it can be referred to the data structure
-    // or the members inside the structure.
-    if ((*itr)["id"] == ref_decl_id)
-      return nodes.at(index);
+  // Mirrors the order find_decl_ref used to search the AST in: a decl outside
+  // of the contracts is reported in the contract before it, if any
+  const std::string *last_contract = nullptr;
 
+  auto index_members = [this](
+                         const nlohmann::json &def,
+                         const std::string *contract_name) {
     if (
-      (*itr)["nodeType"] == "EnumDefinition" ||
-      (*itr)["nodeType"] == "StructDefinition")
+      (def["nodeType"] == "EnumDefinition" ||
+       def["nodeType"] == "StructDefinition") &&
+      def.contains("members"))
     {
-      unsigned men_idx = 0;
-      nlohmann::json &mem_nodes = nodes.at(index)["members"];
-      for (nlohmann::json::iterator mem_itr = mem_nodes.begin();
-           mem_itr != mem_nodes.end();
-           ++mem_itr, ++men_idx)
-      {
-        if ((*mem_itr)["id"] == ref_decl_id)
-          return mem_nodes.at(men_idx);
-      }
+      for (const nlohmann::json &member : def["members"])
+        if (member.contains("id"))
+          decl_index.emplace(
+            member["id"].get<int>(), decl_reft{&member, contract_name});
     }
+  };
 
-    // check the nodes inside a contract
-    if ((*itr)["nodeType"] == "ContractDefinition")
-    {
-      contract_name = (*itr)["name"].get<std::string>();
-      nlohmann::json &ast_nodes = nodes.at(index)["nodes"];
+  for (const nlohmann::json &node : std::as_const(ast_json)["nodes"])
+  {
+    if (node.contains("id"))
+      decl_index.emplace(
+        node["id"].get<int>(), decl_reft{&node, last_contract});
+    index_members(node, last_contract);
 
-      unsigned idx = 0;
-      for (nlohmann::json::iterator itrr = ast_nodes.begin();
-           itrr != ast_nodes.end();
-           ++itrr, ++idx)
-      {
-        if ((*itrr)["id"] == ref_decl_id)
-          return ast_nodes.at(idx);
+    if (node["nodeType"] != "ContractDefinition")
+      continue;
 
-        if (
-          (*itrr)["nodeType"] == "EnumDefinition" ||
-          (*itrr)["nodeType"] == "StructDefinition")
-        {
-          unsigned men_idx = 0;
-
-          nlohmann::json &mem_nodes = ast_nodes.at(idx)["members"];
+    last_contract = &node["name"].get_ref<const std::string &>();
+    for (const nlohmann::json &sub_node : node["nodes"])
+    {
+      if (sub_node.contains("id"))
+        decl_index.emplace(
+          sub_node["id"].get<int>(), decl_reft{&sub_node, last_contract});
+      index_members(sub_node, last_contract);
 
-          for (nlohmann::json::iterator mem_itr = mem_nodes.begin();
-               mem_itr != mem_nodes.end();
-               ++mem_itr, ++men_idx)
-          {
-            if ((*mem_itr)["id"] == ref_decl_id)
-              return mem_nodes.at(men_idx);
-          }
-        }
-      }
+      if (
+        sub_node.contains("kind") && sub_node["kind"] == "constructor" &&
+        node.contains("id"))
+        constructor_index.emplace(node["id"].get<int>(), &sub_node);
     }
   }
 
-  //! otherwise, assume it is current_contractName
-  contract_name = current_contractName;
+  index_local_decls(ast_json);
+}
 
-  // current_functionDecl should not be a nullptr
-  if (current_functionDecl == nullptr)
+void solidity_convertert::index_local_decls(const nlohmann::json &node)
+{
+  if (node.is_object())
   {
-    log_error("Empty current_functionDecl pointer.");
-    abort();
-  }
+    if (
+      node.contains("nodeType") && node["nodeType"] == "VariableDeclaration" &&
+      node.contains("id"))
+    {
+      int id = node["id"].get<int>();
+      if (!decl_index.count(id))
+        local_decl_index.emplace(id, &node);
+    }
 
-  // Then search "declarations" in current function scope
-  const nlohmann::json &current_func = *current_functionDecl;
-  if (!current_func.contains("body"))
+    for (const auto &member : node.items())
+      index_local_decls(member.value());
+  }
+  else if (node.is_array())
   {
-    log_error(
-      "Unable to find the corresponding local variable decl. Current function "
-      "does not have a function body.");
-    abort();
+    for (const nlohmann::json &element : node)
+      index_local_decls(element);
   }
+}
 
-  // var declaration in local statements
-  // bfs visit
-  std::queue<const nlohmann::json *> body_stmts;
-  body_stmts.emplace(&current_func["body"]);
-
-  while (!body_stmts.empty())
+const nlohmann::json &
+solidity_convertert::find_decl_ref(int ref_decl_id, std::string &contract_name)
+{
+  if (ref_decl_id < 0)
   {
-    const nlohmann::json &top_stmt = *(body_stmts).front();
-    for (const auto &body_stmt : top_stmt["statements"].items())
-    {
-      const nlohmann::json &stmt = body_stmt.value();
-      if (stmt["nodeType"] == "VariableDeclarationStatement")
-      {
-        for (const auto &local_decl : stmt["declarations"].items())
-        {
-          const nlohmann::json &the_decl = local_decl.value();
-          if (the_decl["id"] == ref_decl_id)
-          {
-            assert(the_decl.contains("nodeType"));
-            return the_decl;
-          }
-        }
-      }
-
-      // nested block e.g.
-      // {
-      //    {
-      //        int x = 1;
-      //    }
-      // }
-      if (stmt["nodeType"] == "Block" && stmt.contains("statements"))
-        body_stmts.emplace(&stmt);
-    }
-
-    body_stmts.pop();
+    log_warning("Cannot find declaration reference for the built-in function.");
+    abort();
   }
 
-  // Search function parameter
-  if (current_func.contains("parameters"))
+  // First, search the state variables, functions and data structures
+  auto it = decl_index.find(ref_decl_id);
+  if (it != decl_index.end())
   {
-    if (current_func["parameters"]["parameters"].size())
-    {
-      // var decl in function parameter array
-      for (const auto &param_decl :
-           current_func["parameters"]["parameters"].items())
-      {
-        const nlohmann::json &param = param_decl.value();
-        assert(param["nodeType"] == "VariableDeclaration");
-        if (param["id"] == ref_decl_id)
-          return param;
-      }
-    }
+    if (it->second.contract_name)
+      contract_name = *it->second.contract_name;
+    return *it->second.decl;
   }
 
-  // if no matching state or local var decl, search decl in current_forStmt
-  const nlohmann::json &current_for = *current_forStmt;
-  if (current_for.contains("initializationExpression"))
+  //! otherwise, assume it is current_contractName
+  contract_name = current_contractName;
+
+  // current_functionDecl should not be a nullptr
+  if (current_functionDecl == nullptr)
   {
-    if (current_for["initializationExpression"].contains("declarations"))
-    {
-      assert(current_for["initializationExpression"]["declarations"]
-               .size()); // Assuming a non-empty declaration array
-      const nlohmann::json &decls =
-        current_for["initializationExpression"]["declarations"];
-      for (const auto &init_decl : decls.items())
-      {
-        const nlohmann::json &the_decl = init_decl.value();
-        if (the_decl["id"] == ref_decl_id)
-          return the_decl;
-      }
-    }
-    else
-      assert(!"Unable to find the corresponding local variable decl. No local declarations found in current For-Statement");
+    log_error("Empty current_functionDecl pointer.");
+    abort();
   }
-  else
-    assert(!"Unable to find the corresponding local variable decl. Current For-Statement does not have any init.");
 
-  assert(!"should not be here - no matching ref decl id found");
-  return ast_json;
+  // Then search local variables and function parameters
+  auto local = local_decl_index.find(ref_decl_id);
+  if (local != local_decl_index.end())
+    return *local->second;
+
+  log_error(
+    "Unable to find the corresponding decl for reference {}", ref_decl_id);
+  abort();
 }
 
 // return construcor node
 const nlohmann::json &solidity_convertert::find_constructor_ref(int ref_decl_id)
 {
-  nlohmann::json &nodes = ast_json["nodes"];
-  unsigned index = 0;
-  for (nlohmann::json::iterator itr = nodes.begin(); itr != nodes.end();
-       ++itr, ++index)
-  {
-    if (
-      (*itr)["id"].get<int>() == ref_decl_id &&
-      (*itr)["nodeType"] == "ContractDefinition")
-    {
-      nlohmann::json &ast_nodes = nodes.at(index)["nodes"];
-      unsigned idx = 0;
-      for (nlohmann::json::iterator ittr = ast_nodes.begin();
-           ittr != ast_nodes.end();
-           ++ittr, ++idx)
-      {
-        if ((*ittr)["kind"] == "constructor")
-        {
-          return ast_nodes.at(idx);
-        }
-      }
-    }
-  }
+  auto it = constructor_index.find(ref_decl_id);
+  if (it != constructor_index.end())
+    return *it->second;
 
   // implicit constructor call
   return empty_json;
@@ -4145,7 +4085,7 @@ bool solidity_convertert::get_constructor_call(
   const std::string contract_name = exportedSymbolsList[ref_decl_id];
   assert(!contract_name.empty());
 
-  const nlohmann::json constructor_ref = find_constructor_ref(ref_decl_id);
+  const nlohmann::json &constructor_ref = find_constructor_ref(ref_decl_id);
 
   // Special handling of implicit constructor
   // since there is no ast nodes for implicit constructor
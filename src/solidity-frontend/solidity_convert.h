@@ -126,6 +126,8 @@ protected:
   // auxiliary functions
   std::string get_modulename_from_path(std::string path);
   std::string get_filename_from_path(std::string path);
+  void index_ast();
+  void index_local_decls(const nlohmann::json &node);
   const nlohmann::json &find_decl_ref(int ref_decl_id);
   const nlohmann::json &
   find_decl_ref(int ref_decl_id, std::string &contract_name);
@@ -203,6 +205,25 @@ protected:
   // Store the ast_node["id"] of contract/struct/function/...
   std::unordered_map<int, std::string> scope_map;
 
+  // Index of the AST built once by index_ast(), so that references are
+  // resolved without searching the AST
+  struct decl_reft
+  {
+    const nlohmann::json *decl;
+    // The contract find_decl_ref reports the decl in, nullptr to leave the
+    // caller's contract name unchanged
+    const std::string *contract_name;
+  };
+  // Declarations at the top level, in contracts and in structs and enums
+  std::unordered_map<int, decl_reft> decl_index;
+  // Variable declarations inside functions
+  std::unordered_map<int, const nlohmann::json *> local_decl_index;
+  // Explicit constructor of each contract, by contract id
+  std::unordered_map<int, const nlohmann::json *> constructor_index;
+  // Types of the type descriptions that do not depend on the context, by
+  // typeIdentifier and typeString
+  std::unordered_map<std::string, typet> type_description_cache;
+
   static constexpr const char *mode = "C++";
 
   // The prefix for the id of each class
@@ -82,6 +82,31 @@ const std::map<ElementaryTypeNameT, unsigned int> bytesn_size_map = {
   {BYTES31, 31}, {BYTES32, 32},
 };
 
+const std::unordered_map<std::string, StatementT> statement_map = {
+  {"ExpressionStatement", ExpressionStatement},
+  {"VariableDeclarationStatement", VariableDeclStatement},
+  {"Return", ReturnStatement},
+  {"ForStatement", ForStatement},
+  {"Block", Block},
+  {"IfStatement", IfStatement},
+  {"WhileStatement", WhileStatement},
+  {"Continue", ContinueStatement},
+  {"Break", BreakStatement},
+  {"RevertStatement", RevertStatement},
+};
+const std::unordered_map<std::string, ExpressionT> binary_operator_map = {
+  {"=", BO_Assign},       {"+", BO_Add},          {"-", BO_Sub},
+  {"*", BO_Mul},          {"/", BO_Div},          {"%", BO_Rem},
+  {"<<", BO_Shl},         {">>", BO_Shr},         {"&", BO_And},
+  {"^", BO_Xor},          {"|", BO_Or},           {">", BO_GT},
+  {"<", BO_LT},           {">=", BO_GE},          {"<=", BO_LE},
+  {"!=", BO_NE},          {"==", BO_EQ},          {"&&", BO_LAnd},
+  {"||", BO_LOr},         {"+=", BO_AddAssign},   {"-=", BO_SubAssign},
+  {"*=", BO_MulAssign},   {"/=", BO_DivAssign},   {"%=", BO_RemAssign},
+  {"<<=", BO_ShlAssign},  {">>=", BO_ShrAssign},  {"&=", BO_AndAssign},
+  {"^=", BO_XorAssign},   {"|=", BO_OrAssign},    {"**", BO_Pow},
+};
+
 // rule contract-body-element
 ContractBodyElementT get_contract_body_element_t(const nlohmann::json &element)
 {
@@ -567,55 +592,16 @@ const char *block_to_str(BlockT type)
 // rule statement
 StatementT get_statement_t(const nlohmann::json &stmt)
 {
-  if (stmt["nodeType"] == "ExpressionStatement")
-  {
-    return ExpressionStatement;
-  }
-  else if (stmt["nodeType"] == "VariableDeclarationStatement")
-  {
-    return VariableDeclStatement;
-  }
-  else if (stmt["nodeType"] == "Return")
-  {
-    return ReturnStatement;
-  }
-  else if (stmt["nodeType"] == "ForStatement")
-  {
-    return ForStatement;
-  }
-  else if (stmt["nodeType"] == "Block")
-  {
-    return Block;
-  }
-  else if (stmt["nodeType"] == "IfStatement")
-  {
-    return IfStatement;
-  }
-  else if (stmt["nodeType"] == "WhileStatement")
-  {
-    return WhileStatement;
-  }
-  else if (stmt["nodeType"] == "Continue")
-  {
-    return ContinueStatement;
-  }
-  else if (stmt["nodeType"] == "Break")
-  {
-    return BreakStatement;
-  }
-  else if (stmt["nodeType"] == "RevertStatement")
-  {
-    return RevertStatement;
-  }
-
-  else
+  const std::string &node_type =
+    stmt["nodeType"].get_ref<const std::string &>();
+  auto it = statement_map.find(node_type);
+  if (it == statement_map.end())
   {
     log_error(
-      "Got statement nodeType={}. Unsupported statement type",
-      stmt["nodeType"].get<std::string>());
+      "Got statement nodeType={}. Unsupported statement type", node_type);
     abort();
   }
-  return StatementTError;
+  return it->second;
 }
 
 const char *statement_to_str(StatementT type)
@@ -644,32 +630,33 @@ const char *statement_to_str(StatementT type)
 // rule expression
 ExpressionT get_expression_t(const nlohmann::json &expr)
 {
-  if (expr["nodeType"] == "Assignment" || expr["nodeType"] == "BinaryOperation")
+  const std::string &node_type =
+    expr["nodeType"].get_ref<const std::string &>();
+  if (node_type == "Assignment" || node_type == "BinaryOperation")
   {
     return BinaryOperatorClass;
   }
-  else if (expr["nodeType"] == "UnaryOperation")
+  else if (node_type == "UnaryOperation")
   {
     return UnaryOperatorClass;
   }
-  else if (expr["nodeType"] == "Conditional")
+  else if (node_type == "Conditional")
   {
     return ConditionalOperatorClass;
   }
-  else if (
-    expr["nodeType"] == "Identifier" && expr.contains("referencedDeclaration"))
+  else if (node_type == "Identifier" && expr.contains("referencedDeclaration"))
   {
     return DeclRefExprClass;
   }
-  else if (expr["nodeType"] == "Literal")
+  else if (node_type == "Literal")
   {
     return Literal;
   }
-  else if (expr["nodeType"] == "TupleExpression")
+  else if (node_type == "TupleExpression")
   {
     return Tuple;
   }
-  else if (expr["nodeType"] == "FunctionCall")
+  else if (node_type == "FunctionCall")
   {
     if (expr["expression"]["nodeType"] == "NewExpression")
       return NewExpression;
@@ -679,7 +666,7 @@ ExpressionT get_expression_t(const nlohmann::json &expr)
       return ElementaryTypeNameExpression;
     return CallExprClass;
   }
-  else if (expr["nodeType"] == "MemberAccess")
+  else if (node_type == "MemberAccess")
   {
     assert(expr.contains("expression"));
     SolidityGrammar::TypeNameT type_name =
@@ -691,19 +678,18 @@ ExpressionT get_expression_t(const nlohmann::json &expr)
     if (type_name == SolidityGrammar::TypeNameT::ContractTypeName)
       return ContractMemberCall;
   }
-  else if (expr["nodeType"] == "ImplicitCastExprClass")
+  else if (node_type == "ImplicitCastExprClass")
   {
     return ImplicitCastExprClass;
   }
-  else if (expr["nodeType"] == "IndexAccess")
+  else if (node_type == "IndexAccess")
   {
     return IndexAccess;
   }
   else
   {
     log_error(
-      "Got expression nodeType={}. Unsupported expression type",
-      expr["nodeType"].get<std::string>());
+      "Got expression nodeType={}. Unsupported expression type", node_type);
     abort();
   }
   return ExpressionTError;
@@ -749,135 +735,15 @@ ExpressionT get_unary_expr_operator_t(const nlohmann::json &expr, bool uo_pre)
 
 ExpressionT get_expr_operator_t(const nlohmann::json &expr)
 {
-  if (expr["operator"] == "=")
-  {
-    return BO_Assign;
-  }
-  else if (expr["operator"] == "+")
-  {
-    return BO_Add;
-  }
-  else if (expr["operator"] == "-")
-  {
-    return BO_Sub;
-  }
-  else if (expr["operator"] == "*")
-  {
-    return BO_Mul;
-  }
-  else if (expr["operator"] == "/")
-  {
-    return BO_Div;
-  }
-  else if (expr["operator"] == "%")
-  {
-    return BO_Rem;
-  }
-  else if (expr["operator"] == "<<")
-  {
-    return BO_Shl;
-  }
-  else if (expr["operator"] == ">>")
-  {
-    return BO_Shr;
-  }
-  else if (expr["operator"] == "&")
-  {
-    return BO_And;
-  }
-  else if (expr["operator"] == "^")
-  {
-    return BO_Xor;
-  }
-  else if (expr["operator"] == "|")
-  {
-    return BO_Or;
-  }
-  else if (expr["operator"] == ">")
-  {
-    return BO_GT;
-  }
-  else if (expr["operator"] == "<")
-  {
-    return BO_LT;
-  }
-  else if (expr["operator"] == ">=")
-  {
-    return BO_GE;
-  }
-  else if (expr["operator"] == "<=")
-  {
-    return BO_LE;
-  }
-  else if (expr["operator"] == "!=")
-  {
-    return BO_NE;
-  }
-  else if (expr["operator"] == "==")
-  {
-    return BO_EQ;
-  }
-  else if (expr["operator"] == "&&")
-  {
-    return BO_LAnd;
-  }
-  else if (expr["operator"] == "||")
-  {
-    return BO_LOr;
-  }
-  else if (expr["operator"] == "+=")
-  {
-    return BO_AddAssign;
-  }
-  else if (expr["operator"] == "-=")
-  {
-    return BO_SubAssign;
-  }
-  else if (expr["operator"] == "*=")
-  {
-    return BO_MulAssign;
-  }
-  else if (expr["operator"] == "/=")
-  {
-    return BO_DivAssign;
-  }
-  else if (expr["operator"] == "%=")
-  {
-    return BO_RemAssign;
-  }
-  else if (expr["operator"] == "<<=")
-  {
-    return BO_ShlAssign;
-  }
-  else if (expr["operator"] == ">>=")
-  {
-    return BO_ShrAssign;
-  }
-  else if (expr["operator"] == "&=")
-  {
-    return BO_AndAssign;
-  }
-  else if (expr["operator"] == "^=")
-  {
-    return BO_XorAssign;
-  }
-  else if (expr["operator"] == "|=")
-  {
-    return BO_OrAssign;
-  }
-  else if (expr["operator"] == "**")
-  {
-    return BO_Pow;
-  }
-  else
+  const std::string &op = expr["operator"].get_ref<const std::string &>();
+  auto it = binary_operator_map.find(op);
+  if (it == binary_operator_map.end())
   {
     log_error(
-      "Got expression operator={}. Unsupported expression operator",
-      expr["operator"].get<std::string>());
+      "Got expression operator={}. Unsupported expression operator", op);
     abort();
   }
-
-  return ExpressionTError; // make some old compilers happy
+  return it->second;
 }
 
 const char *expression_to_str(ExpressionT type)
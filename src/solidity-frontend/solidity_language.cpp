@@ -14,6 +14,38 @@ CC_DIAGNOSTIC_POP()
 #include <c2goto/cprover_library.h>
 #include <util/c_link.h>
 
+#include <unordered_set>
+
+/// Decide while parsing solc's output whether to keep a member of the AST.
+/// Members holding analysis results and source locations that the converter
+/// never reads are dropped, so that they take no memory in the parsed AST.
+static bool keep_ast_member(
+  int depth,
+  nlohmann::json::parse_event_t event,
+  nlohmann::json &parsed)
+{
+  static const std::unordered_set<std::string> unused_members = {
+    "contractDependencies",
+    "documentation",
+    "functionSelector",
+    "isConstant",
+    "isLValue",
+    "isPure",
+    "lValueRequested",
+    "memberLocation",
+    "nameLocations",
+    "overloadedDeclarations",
+    "tryCall",
+    "usedErrors"};
+
+  // The members of the source unit and of exportedSymbols, which are named
+  // after the contracts, are always kept
+  if (event != nlohmann::json::parse_event_t::key || depth <= 2)
+    return true;
+
+  return !unused_members.count(parsed.get_ref<const std::string &>());
+}
+
 languaget *new_solidity_language()
 {
   return new solidity_languaget;
@@ -76,7 +108,7 @@ bool solidity_languaget::parse(const std::string &path)
 
   // Process AST json file
   std::ifstream ast_json_file_stream(path);
-  std::string new_line, ast_json_content;
+  std::string new_line;
 
   while (getline(ast_json_file_stream, new_line))
   {
@@ -85,21 +117,18 @@ bool solidity_languaget::parse(const std::string &path)
       break;
     }
   }
-  while (getline(ast_json_file_stream, new_line))
+
+  // Parse the rest of the file as it is read, rather than reading it into a
+  // string first: solc outputs of large projects reach hundreds of MB
+  try
   {
-    // file pointer continues from "=== *.sol ==="
-    if (new_line.find(".sol =======") == std::string::npos)
-    {
-      ast_json_content = ast_json_content + new_line + "\n";
-    }
-    else
-    {
-      assert(!"Unsupported feature: found multiple contracts defined in a single .sol file");
-    }
+    ast_json = nlohmann::json::parse(ast_json_file_stream, keep_ast_member);
+  }
+  catch (const nlohmann::json::exception &e)
+  {
+    log_error("Failed to parse the solc AST in {}: {}", path, e.what());
+    return true;
   }
-
-  // parse explicitly
-  ast_json = nlohmann::json::parse(ast_json_content);
 
   return false;
 }
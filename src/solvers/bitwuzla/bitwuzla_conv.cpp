@@ -57,6 +57,8 @@ smt_convt::resultt bitwuzla_convt::dec_solve()
   pre_solve();
 
   BitwuzlaResult result = bitwuzla_check_sat(bitw);
+  while (result == BITWUZLA_SAT && refine_model())
+    result = bitwuzla_check_sat(bitw);
 
   if (result == BITWUZLA_SAT)
     return P_SATISFIABLE;
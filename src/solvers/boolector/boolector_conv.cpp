@@ -35,7 +35,9 @@ boolector_convt::boolector_convt(const namespacet &ns, const optionst &options)
   btor = boolector_new();
   boolector_set_opt(btor, BTOR_OPT_MODEL_GEN, 1);
   boolector_set_opt(btor, BTOR_OPT_AUTO_CLEANUP, 1);
-  if (options.get_bool_option("smt-during-symex"))
+  if (
+    options.get_bool_option("smt-during-symex") ||
+    options.get_bool_option("array-flattener-lazy"))
     boolector_set_opt(btor, BTOR_OPT_INCREMENTAL, 1);
   boolector_set_abort(error_handler);
 }
@@ -63,6 +65,8 @@ smt_convt::resultt boolector_convt::dec_solve()
   pre_solve();
 
   int result = boolector_sat(btor);
+  while (result == BOOLECTOR_SAT && refine_model())
+    result = boolector_sat(btor);
 
   if (result == BOOLECTOR_SAT)
     return P_SATISFIABLE;
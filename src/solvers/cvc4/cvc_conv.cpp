@@ -28,6 +28,8 @@ cvc_convt::cvc_convt(const namespacet &ns, const optionst &options)
   // Already initialized stuff in the constructor list,
   smt.setOption("produce-models", true);
   smt.setOption("produce-assertions", true);
+  if (options.get_bool_option("array-flattener-lazy"))
+    smt.setOption("incremental", true);
 }
 
 smt_convt::resultt cvc_convt::dec_solve()
@@ -35,6 +37,8 @@ smt_convt::resultt cvc_convt::dec_solve()
   pre_solve();
 
   CVC4::Result r = smt.checkSat();
+  while (r.isSat() && refine_model())
+    r = smt.checkSat();
   if (r.isSat())
     return P_SATISFIABLE;
 
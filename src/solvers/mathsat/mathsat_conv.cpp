@@ -88,6 +88,8 @@ smt_convt::resultt mathsat_convt::dec_solve()
   pre_solve();
 
   msat_result r = msat_solve(env);
+  while (r == MSAT_SAT && refine_model())
+    r = msat_solve(env);
   if (r == MSAT_SAT)
     return P_SATISFIABLE;
 
@@ -91,6 +91,8 @@ smt_convt::resultt minisat_convt::dec_solve()
     return smt_convt::P_UNSATISFIABLE;
 
   bool res = solver.solve();
+  while (res && refine_model())
+    res = !false_asserted && solver.solve();
   if (res)
     return smt_convt::P_SATISFIABLE;
   else
@@ -1,6 +1,8 @@
 #include <algorithm>
+#include <map>
 #include <set>
 #include <solvers/smt/array_conv.h>
+#include <unordered_map>
 #include <util/c_types.h>
 #include <utility>
 
@@ -20,7 +22,8 @@ static inline bool array_indexes_are_same(
   return true;
 }
 
-array_convt::array_convt(smt_convt *_ctx) : array_iface(true, true), ctx(_ctx)
+array_convt::array_convt(smt_convt *_ctx, bool _lazy_axioms)
+  : array_iface(true, true), lazy_axioms(_lazy_axioms), ctx(_ctx)
 {
 }
 
@@ -527,6 +530,104 @@ void array_convt::add_array_constraints_for_solving()
   add_array_equalities();
 }
 
+bool array_convt::refine_array_model()
+{
+  if (!lazy_axioms)
+    return false;
+
+  // Check both kinds of constraints against the same model: adding
+  // constraints to the solver discards it, so they are only added at the end.
+  ast_vect lemmas;
+  refine_ackermann_constraints(lemmas);
+  refine_array_updates(lemmas);
+
+  for (smt_astt lemma : lemmas)
+    ctx->assert_ast(lemma);
+
+  return !lemmas.empty();
+}
+
+bool array_convt::model_equal(smt_astt a, smt_astt b)
+{
+  if (a == b)
+    return true;
+
+  switch (a->sort->id)
+  {
+  case SMT_SORT_BOOL:
+    return ctx->get_bool(a) == ctx->get_bool(b);
+  case SMT_SORT_BV:
+  case SMT_SORT_FIXEDBV:
+  case SMT_SORT_BVFP:
+  case SMT_SORT_BVFP_RM:
+    return ctx->get_bv(a, false) == ctx->get_bv(b, false);
+  default:
+    return ctx->get_bool(a->eq(ctx, b));
+  }
+}
+
+void array_convt::refine_ackermann_constraints(ast_vect &lemmas)
+{
+  // Elements at indexes with the same value in the model must have the same
+  // value too. Comparing each of them with the first element at that value
+  // is enough, the constraints added for violations make the rest follow.
+  unsigned int added = 0;
+  for (unsigned int arrid = 0; arrid < expr_index_map.size(); arrid++)
+  {
+    const ast_vect &vals = array_valuation[arrid][0];
+    std::map<BigInt, std::pair<smt_astt, smt_astt>> firsts;
+
+    for (auto const &it : expr_index_map[arrid])
+    {
+      if (it.vec_idx >= vals.size() || !vals[it.vec_idx])
+        continue;
+
+      smt_astt idx = ctx->convert_ast(it.idx);
+      smt_astt val = vals[it.vec_idx];
+      auto [first, inserted] =
+        firsts.emplace(ctx->get_bv(idx, false), std::make_pair(idx, val));
+      if (inserted || model_equal(val, first->second.second))
+        continue;
+
+      smt_astt idxeq = idx->eq(ctx, first->second.first);
+      smt_astt valeq = val->eq(ctx, first->second.second);
+      lemmas.push_back(ctx->mk_implies(idxeq, valeq));
+      added++;
+    }
+  }
+
+  if (added)
+    log_debug("array-conv", "adding {} Ackermann constraints", added);
+}
+
+void array_convt::refine_array_updates(ast_vect &lemmas)
+{
+  // Each element of an updated array is the updated value if its index is
+  // the updated one in the model, or the source element otherwise.
+  std::unordered_map<smt_astt, BigInt> idx_values;
+  auto value = [this, &idx_values](smt_astt idx) -> const BigInt & {
+    auto [it, inserted] = idx_values.try_emplace(idx);
+    if (inserted)
+      it->second = ctx->get_bv(idx, false);
+    return it->second;
+  };
+
+  unsigned int added = 0;
+  for (const lazy_update &u : lazy_updates)
+  {
+    bool updated = value(u.update_idx) == value(u.idx);
+    if (model_equal(u.dest, updated ? u.val : u.src))
+      continue;
+
+    smt_astt cond = u.update_idx->eq(ctx, u.idx);
+    lemmas.push_back(u.dest->eq(ctx, u.val->ite(ctx, cond, u.src)));
+    added++;
+  }
+
+  if (added)
+    log_debug("array-conv", "adding {} array update constraints", added);
+}
+
 void array_convt::push_array_ctx()
 {
   // The most important factor in this process is to make sure that new indexes
@@ -583,6 +684,12 @@ void array_convt::pop_array_ctx()
   array_valuation.resize(num_arrays); // terrible terrible damage
 
   array_equalities.erase(target_ctx); // Erase everything with that idx
+  lazy_updates.erase(
+    std::remove_if(
+      lazy_updates.begin(),
+      lazy_updates.end(),
+      [target_ctx](const lazy_update &u) { return u.ctx_level >= target_ctx; }),
+    lazy_updates.end());
   auto &ctx_idx = array_of_vals.get<1>();
   ctx_idx.erase(target_ctx); // Similar
 
@@ -1152,7 +1259,20 @@ void array_convt::execute_array_update(
     // This departs from the CBMC implementation, in that they explicitly
     // use implies and ackerman constraints.
     // FIXME: benchmark the two approaches. For now, this is shorter.
-    smt_astt cond = update_idx_ast->eq(ctx, ctx->convert_ast(it2.idx));
+    smt_astt idx_ast = ctx->convert_ast(it2.idx);
+    if (lazy_axioms)
+    {
+      lazy_updates.push_back(
+        {dest_data[it2.vec_idx],
+         source_data[it2.vec_idx],
+         updated_value,
+         update_idx_ast,
+         idx_ast,
+         ctx->ctx_level});
+      continue;
+    }
+
+    smt_astt cond = update_idx_ast->eq(ctx, idx_ast);
     smt_astt dest_ite = updated_value->ite(ctx, cond, source_data[it2.vec_idx]);
     ctx->assert_ast(dest_data[it2.vec_idx]->eq(ctx, dest_ite));
   }
@@ -1303,6 +1423,9 @@ void array_convt::add_initial_ackerman_constraints(
   // Add ackerman constraints: these state that for each element of an array,
   // where the indexes are equivalent (in the solver), then the value of the
   // elements are equivalent. The cost is quadratic, alas.
+  // In lazy mode, they're only added when a model violates them.
+  if (lazy_axioms)
+    return;
 
   for (auto const &it : idx_map)
   {
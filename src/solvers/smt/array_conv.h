@@ -125,7 +125,7 @@ public:
         std::greater<unsigned int>>>>
     index_map_containert;
 
-  array_convt(smt_convt *_ctx);
+  array_convt(smt_convt *_ctx, bool _lazy_axioms = false);
   ~array_convt() = default;
 
   // Public api
@@ -138,6 +138,7 @@ public:
   smt_astt
   convert_array_of(smt_astt init_val, unsigned long domain_width) override;
   void add_array_constraints_for_solving() override;
+  bool refine_array_model() override;
 
   // Heavy lifters
   virtual smt_astt convert_array_of_wsort(
@@ -250,6 +251,10 @@ public:
   void push_array_ctx() override;
   void pop_array_ctx() override;
 
+  bool model_equal(smt_astt a, smt_astt b);
+  void refine_ackermann_constraints(ast_vect &lemmas);
+  void refine_array_updates(ast_vect &lemmas);
+
   // Members
 
   // Array tracking: each new root array (from fresh_array) gets its own
@@ -442,6 +447,28 @@ public:
   // indexed by the context level.
   std::vector<unsigned int> num_arrays_history;
 
+  // Lazy axiom instantiation. The Ackermann constraints between the initial
+  // elements of an array and the constraints tying each element of an
+  // updated array to the element before the update are quadratic in the
+  // number of indexes. With lazy_axioms set, they are not encoded up front:
+  // refine_array_model() checks the model found by the solver against them
+  // and only encodes those it violates, until the model satisfies them all.
+  bool lazy_axioms;
+
+  // An element of an updated array that is yet to be constrained to be
+  // either the updated value or the element of the source array.
+  struct lazy_update
+  {
+    smt_astt dest;
+    smt_astt src;
+    smt_astt val;
+    smt_astt update_idx;
+    smt_astt idx;
+    unsigned int ctx_level;
+  };
+
+  std::vector<lazy_update> lazy_updates;
+
   // Finally, for model building, we need all the past array values. Three
   // vectors, dimensions are arrays id's, historical point, array element,
   // respectively.
@@ -51,6 +51,15 @@ public:
 
   virtual void add_array_constraints_for_solving(){};
 
+  /** Check the model of a satisfiable formula against the array constraints
+   *  that have not been encoded yet, and encode those that it violates.
+   *  @return Whether constraints were added, i.e., whether the formula has
+   *          to be solved again. */
+  virtual bool refine_array_model()
+  {
+    return false;
+  }
+
   virtual void push_array_ctx(){};
   virtual void pop_array_ctx(){};
 
@@ -1,5 +1,4 @@
 #include <solvers/smt/smt_conv.h>
-#include <sstream>
 #include <util/base_type.h>
 #include <util/expr_util.h>
 #include <util/message.h>
@@ -413,7 +412,6 @@ smt_astt smt_convt::convert_typecast_to_ptr(const typecast2t &cast)
 
   // First cast it to an unsignedbv
   type2tc int_type = ptraddr_type2();
-  smt_sortt int_sort = convert_sort(int_type);
   expr2tc cast_to_unsigned = typecast2tc(int_type, cast.from);
   smt_astt target = convert_ast(cast_to_unsigned);
 
@@ -431,11 +429,9 @@ smt_astt smt_convt::convert_typecast_to_ptr(const typecast2t &cast)
     unsigned id = it->first;
     obj_ids[i] = convert_terminal(constant_int2tc(int_type, BigInt(id)));
 
-    std::stringstream ss1, ss2;
-    ss1 << "__ESBMC_ptr_obj_start_" << id;
-    smt_astt ptr_start = mk_smt_symbol(ss1.str(), int_sort);
-    ss2 << "__ESBMC_ptr_obj_end_" << id;
-    smt_astt ptr_end = mk_smt_symbol(ss2.str(), int_sort);
+    auto [start, end] = addr_space_bounds(id);
+    smt_astt ptr_start = convert_ast(start);
+    smt_astt ptr_end = convert_ast(end);
 
     obj_starts[i] = ptr_start;
 
@@ -9,8 +9,11 @@
 #include <util/expr_util.h>
 #include <util/message.h>
 #include <util/message/format.h>
+#include <util/perf_report.h>
 #include <util/type_byte_size.h>
 
+static perf_countert model_cache_hits("model-cache-hits");
+
 // Helpers extracted from z3_convt.
 
 static std::string extract_magnitude(const std::string &v, unsigned width)
@@ -105,6 +108,7 @@ smt_convt::smt_convt(const namespacet &_ns, const optionst &_options)
   addr_space_arr_type = array_type2tc(addr_space_type, expr2tc(), true);
 
   addr_space_data.emplace_back();
+  addr_space_last.push_back(0);
 
   machine_ptr = get_uint_type(config.ansi_c.pointer_width()); /* CHERI-TODO */
 
@@ -168,6 +172,7 @@ void smt_convt::push_ctx()
   array_api->push_array_ctx();
 
   addr_space_data.push_back(addr_space_data.back());
+  addr_space_last.push_back(addr_space_last.back());
   addr_space_sym_num.push_back(addr_space_sym_num.back());
   pointer_logic.push_back(pointer_logic.back());
   renumber_map.push_back(renumber_map.back());
@@ -183,9 +188,11 @@ void smt_convt::pop_ctx()
   // before the push is going to disappear.
   smt_cachet::nth_index<1>::type &cache_numindex = smt_cache.get<1>();
   cache_numindex.erase(ctx_level);
+  model_cache.clear();
   pointer_logic.pop_back();
   addr_space_sym_num.pop_back();
   addr_space_data.pop_back();
+  addr_space_last.pop_back();
   renumber_map.pop_back();
 
   ctx_level--;
@@ -2255,6 +2262,8 @@ type2tc smt_convt::get_flattened_array_subtype(const type2tc &type)
 
 void smt_convt::pre_solve()
 {
+  model_cache.clear();
+
   // NB: always perform tuple constraint adding first, as it covers tuple
   // arrays too, and might end up generating more ASTs to be encoded in
   // the array api class.
@@ -2262,6 +2271,11 @@ void smt_convt::pre_solve()
   array_api->add_array_constraints_for_solving();
 }
 
+bool smt_convt::refine_model()
+{
+  return array_api->refine_array_model();
+}
+
 expr2tc smt_convt::get(const expr2tc &expr)
 {
   if (is_constant_number(expr))
@@ -2270,6 +2284,20 @@ expr2tc smt_convt::get(const expr2tc &expr)
   if (is_symbol2t(expr) && to_symbol2t(expr).thename == "NULL")
     return expr;
 
+  auto it = model_cache.find(expr);
+  if (it != model_cache.end())
+  {
+    model_cache_hits.add();
+    return it->second;
+  }
+
+  expr2tc res = get_uncached(expr);
+  model_cache.emplace(expr, res);
+  return res;
+}
+
+expr2tc smt_convt::get_uncached(const expr2tc &expr)
+{
   expr2tc res = expr;
 
   // Special cases:
@@ -2916,6 +2944,10 @@ tvt smt_convt::l_get(smt_astt a)
   return get_bool(a) ? tvt(true) : tvt(false);
 }
 
+void smt_convt::fetch_values(const std::vector<smt_astt> &)
+{
+}
+
 expr2tc smt_convt::get_by_value(const type2tc &type, BigInt value)
 {
   switch (type->type_id)
@@ -237,6 +237,12 @@ public:
 
   void pre_solve();
 
+  /** Called by dec_solve() when the formula is satisfiable: adds constraints
+   *  that were left out of the formula and are violated by the model.
+   *  @return Whether constraints were added and the formula has to be solved
+   *          again. */
+  bool refine_model();
+
   /** Get the satisfying assignment using the type.
    *  @param expr Variable to get the value of. Must be a symbol expression.
    *  @return Explicit assigned value of expr in the solver. May be nil, in
@@ -280,6 +286,20 @@ public:
    *  @return A three-valued return val, of the assignment to a. */
   virtual tvt l_get(smt_astt a);
 
+  /** Fetch the values of several asts from the solver's model at once. This
+   *  is only a hint: afterwards, get_bool, get_bv and l_get may answer for
+   *  these asts without asking the solver again. Solvers for which each
+   *  query is expensive override this; the default does nothing.
+   *  @param asts The asts whose values are about to be requested. */
+  virtual void fetch_values(const std::vector<smt_astt> &asts);
+
+  /** Whether fetch_values() does anything for this solver. Callers skip
+   *  collecting and converting the asts to fetch when it doesn't. */
+  virtual bool supports_batch_fetch() const
+  {
+    return false;
+  }
+
   /** @} */
 
   /** @{
@@ -653,9 +673,14 @@ public:
   void bump_addrspace_array(unsigned int idx, const expr2tc &val);
   /** Get the symbol name for the current address-allocation record array. */
   std::string get_cur_addrspace_ident();
+  /** The symbols for the first and the last address reserved for the given
+   *  object ID number. */
+  std::pair<expr2tc, expr2tc> addr_space_bounds(unsigned int obj_num);
   /** Create and assert address space constraints on the given object ID
    *  number. Essentially, this asserts that all the objects to date don't
-   *  overlap with /this/ one. */
+   *  overlap with /this/ one. With --ordered-address-space, it instead places
+   *  this object after the one placed last, which fixes the order of all
+   *  objects in memory and is therefore unsound. */
   void finalize_pointer_chain(unsigned int obj_num);
 
   /** Typecast data to bools */
@@ -746,6 +771,9 @@ public:
   expr2tc get_array(const type2tc &type, smt_astt array);
   expr2tc get_array(const expr2tc &expr);
 
+  /** Build the value of expr from the solver model, see get(). */
+  expr2tc get_uncached(const expr2tc &expr);
+
   void delete_all_asts();
 
   /** @} */
@@ -781,6 +809,10 @@ public:
   smt_cachet smt_cache;
   /** A cache of converted type2tc's to smt sorts */
   smt_sort_cachet sort_cache;
+  /** Values already built by get() from the current model. Shared subterms
+   *  of counterexample values are only fetched once; cleared whenever the
+   *  model may change. */
+  std::unordered_map<expr2tc, expr2tc, irep2_hash> model_cache;
   /** Pointer_logict object, which contains some code for formatting how
    *  pointers are displayed in counter-examples. This is a list so that we
    *  can push and pop data when context push/pop operations occur. */
@@ -826,6 +858,11 @@ public:
    *  the nubmer of bytes allocated. In a list to support pushing and
    *  popping. */
   std::list<std::map<unsigned, unsigned>> addr_space_data;
+  /** The object placed last in the address space, for
+   *  --ordered-address-space. In a list to support pushing and popping. */
+  std::list<unsigned int> addr_space_last;
+  /** Symbols of the address ranges of the objects, by object number. */
+  std::vector<std::pair<expr2tc, expr2tc>> addr_space_bound_syms;
 
   /** Holds the `__ESBMC_alloc` symbol convert_terminal() was last invoked with.
    */
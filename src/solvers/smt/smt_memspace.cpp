@@ -1,5 +1,4 @@
 #include <algorithm>
-#include <sstream>
 #include <solvers/smt/smt_conv.h>
 #include <util/message/format.h>
 #include <util/type_byte_size.h>
@@ -330,14 +329,7 @@ smt_astt smt_convt::init_pointer_obj(
 
   type2tc ptr_loc_type = ptraddr_type2();
 
-  std::stringstream sse1, sse2;
-  sse1 << "__ESBMC_ptr_obj_start_" << obj_num;
-  sse2 << "__ESBMC_ptr_obj_end_" << obj_num;
-  std::string start_name = sse1.str();
-  std::string end_name = sse2.str();
-
-  expr2tc start_sym = symbol2tc(ptr_loc_type, start_name);
-  expr2tc end_sym = symbol2tc(ptr_loc_type, end_name);
+  auto [start_sym, end_sym] = addr_space_bounds(obj_num);
 
   /* The accessible object spans addresses [start, end), including start,
    * excluding end. The addresses reserved for this object however are
@@ -391,9 +383,8 @@ smt_astt smt_convt::init_pointer_obj(
   membs.push_back(start_sym);
   membs.push_back(end_sym);
   expr2tc range_struct = constant_struct2tc(addr_space_type, membs);
-  std::stringstream ss;
-  ss << "__ESBMC_ptr_addr_range_" << obj_num;
-  expr2tc range_sym = symbol2tc(addr_space_type, ss.str());
+  expr2tc range_sym = symbol2tc(
+    addr_space_type, "__ESBMC_ptr_addr_range_" + std::to_string(obj_num));
   expr2tc eq = equality2tc(range_sym, range_struct);
   assert_expr(eq);
 
@@ -403,18 +394,40 @@ smt_astt smt_convt::init_pointer_obj(
   return ptr_val;
 }
 
-void smt_convt::finalize_pointer_chain(unsigned int objnum)
+std::pair<expr2tc, expr2tc> smt_convt::addr_space_bounds(unsigned int obj_num)
 {
   type2tc inttype = ptraddr_type2();
+  while (addr_space_bound_syms.size() <= obj_num)
+  {
+    std::string num = std::to_string(addr_space_bound_syms.size());
+    addr_space_bound_syms.emplace_back(
+      symbol2tc(inttype, "__ESBMC_ptr_obj_start_" + num),
+      symbol2tc(inttype, "__ESBMC_ptr_obj_end_" + num));
+  }
+
+  return addr_space_bound_syms[obj_num];
+}
+
+void smt_convt::finalize_pointer_chain(unsigned int objnum)
+{
   unsigned int num_ptrs = addr_space_data.back().size();
   if (num_ptrs == 0)
     return;
 
-  std::stringstream start1, end1;
-  start1 << "__ESBMC_ptr_obj_start_" << objnum;
-  end1 << "__ESBMC_ptr_obj_end_" << objnum;
-  expr2tc start_i = symbol2tc(inttype, start1.str());
-  expr2tc end_i = symbol2tc(inttype, end1.str());
+  auto [start_i, end_i] = addr_space_bounds(objnum);
+
+  if (options.get_bool_option("ordered-address-space"))
+  {
+    // Place the object after the last one: as every object ends where it
+    // starts or later, this keeps all of them apart with a single constraint
+    // per object. This over-constrains the addresses: objects always lie in
+    // the order they are encoded in, so relations between the addresses of
+    // two objects are fixed, and freed objects are never reused.
+    unsigned int &last = addr_space_last.back();
+    assert_expr(greaterthan2tc(start_i, addr_space_bounds(last).second));
+    last = objnum;
+    return;
+  }
 
   for (unsigned int j = 0; j < objnum; j++)
   {
@@ -422,11 +435,7 @@ void smt_convt::finalize_pointer_chain(unsigned int objnum)
     if (j == 1)
       continue;
 
-    std::stringstream startj, endj;
-    startj << "__ESBMC_ptr_obj_start_" << j;
-    endj << "__ESBMC_ptr_obj_end_" << j;
-    expr2tc start_j = symbol2tc(inttype, startj.str());
-    expr2tc end_j = symbol2tc(inttype, endj.str());
+    auto [start_j, end_j] = addr_space_bounds(j);
 
     // Formula: (i_end < j_start) || (i_start > j_end)
     // Previous assertions ensure start <= end for all objs.
@@ -512,9 +521,10 @@ smt_astt smt_convt::convert_addr_of(const expr2tc &expr)
     // The pointer will remain consistent because any pointer taken to the
     // same constant array will be picked up in the expression cache
     static unsigned int constarr_num = 0;
-    std::stringstream ss;
-    ss << "address_of_arr_const(" << constarr_num++ << ")";
-    return convert_identifier_pointer(obj.ptr_obj, ss.str(), nullptr);
+    return convert_identifier_pointer(
+      obj.ptr_obj,
+      "address_of_arr_const(" + std::to_string(constarr_num++) + ")",
+      nullptr);
   }
 
   if (is_if2t(obj.ptr_obj))
@@ -553,14 +563,12 @@ void smt_convt::init_addr_space_array()
   expr2tc obj1_end_const =
     constant_int2tc(ptr_int_type, BigInt::power2m1(ptr_int_type->get_width()));
 
-  expr2tc obj0_start = symbol2tc(ptr_int_type, "__ESBMC_ptr_obj_start_0");
-  expr2tc obj0_end = symbol2tc(ptr_int_type, "__ESBMC_ptr_obj_end_0");
+  auto [obj0_start, obj0_end] = addr_space_bounds(0);
 
   assert_expr(equality2tc(obj0_start, zero_ptr_int));
   assert_expr(equality2tc(obj0_end, zero_ptr_int));
 
-  expr2tc obj1_start = symbol2tc(ptr_int_type, "__ESBMC_ptr_obj_start_1");
-  expr2tc obj1_end = symbol2tc(ptr_int_type, "__ESBMC_ptr_obj_end_1");
+  auto [obj1_start, obj1_end] = addr_space_bounds(1);
 
   assert_expr(equality2tc(obj1_start, one_ptr_int));
   assert_expr(equality2tc(obj1_end, obj1_end_const));
@@ -628,7 +636,5 @@ void smt_convt::bump_addrspace_array(unsigned int idx, const expr2tc &val)
 
 std::string smt_convt::get_cur_addrspace_ident()
 {
-  std::stringstream ss;
-  ss << "__ESBMC_addrspace_arr_" << addr_space_sym_num.back();
-  return ss.str();
+  return "__ESBMC_addrspace_arr_" + std::to_string(addr_space_sym_num.back());
 }
@@ -10,6 +10,7 @@
 #include <cinttypes>
 #include <regex>
 #include <sstream>
+#include <unordered_set>
 
 #ifndef _WIN32
 #include <unistd.h>
@@ -585,18 +586,26 @@ smt_convt::resultt smtlib_convt::dec_solve()
   // Emit constraints
   // check-sat
 
-  emit("%s", "(check-sat)\n");
+  do
+  {
+    // Values fetched from a previous model are stale now
+    model_values.clear();
 
-  // Flush out command, starting model check
-  flush();
+    emit("%s", "(check-sat)\n");
 
-  // If we're just outputing to a file, this is where we terminate.
-  if (!emit_proc)
-    return smt_convt::P_SMTLIB;
+    // Flush out command, starting model check
+    flush();
 
-  // And read in the output
-  smtlib_send_start_code = 1;
-  smtlibparse(TOK_START_SAT);
+    // If we're just outputing to a file, this is where we terminate.
+    if (!emit_proc)
+      return smt_convt::P_SMTLIB;
+
+    // And read in the output
+    smtlib_send_start_code = 1;
+    smtlibparse(TOK_START_SAT);
+
+    // Check again if constraints violated by the model were added
+  } while (smtlib_output->token == TOK_KW_SAT && refine_model());
 
   // This should generate on sexpr. See what it is.
   if (smtlib_output->token == TOK_KW_SAT)
@@ -619,12 +628,37 @@ smt_convt::resultt smtlib_convt::dec_solve()
   }
 }
 
-sexpr smtlib_convt::get_value(smt_astt a) const
+const sexpr &smtlib_convt::get_value(smt_astt a)
 {
-  assert(emit_proc);
+  auto it = model_values.find(a);
+  if (it != model_values.end())
+    return it->second;
+
+  fetch_values({a});
+  return model_values.at(a);
+}
+
+void smtlib_convt::fetch_values(const std::vector<smt_astt> &asts)
+{
+  if (!emit_proc)
+    return;
+
+  // Ask for everything not known yet in a single get-value command
+  std::vector<smt_astt> query;
+  std::unordered_set<smt_astt> seen;
+  for (smt_astt a : asts)
+    if (a && !model_values.count(a) && seen.insert(a).second)
+      query.push_back(a);
+
+  if (query.empty())
+    return;
 
   emit("%s", "(get-value (");
-  emit_ast(to_solver_smt_ast<smtlib_smt_ast>(a));
+  for (smt_astt a : query)
+  {
+    emit_ast(to_solver_smt_ast<smtlib_smt_ast>(a));
+    emit("%s", " ");
+  }
   emit("%s\n", "))");
   flush();
   smtlib_send_start_code = 1;
@@ -642,23 +676,24 @@ sexpr smtlib_convt::get_value(smt_astt a) const
     log_error("Unrecognized response to get-value from smtlib solver");
     abort();
   }
-  // Unpack our value from response list.
-  assert(
-    smtlib_output->sexpr_list.size() == 1 &&
-    "More than one response to "
-    "get-value from smtlib solver");
-  sexpr &response = *smtlib_output->sexpr_list.begin();
-  // Now we have a valuation pair. First is the symbol
+
   assert(
-    response.sexpr_list.size() == 2 &&
-    "Expected 2 operands in "
-    "valuation_pair_list from smtlib solver");
-  std::list<sexpr>::iterator it = response.sexpr_list.begin();
-  /* sexpr &symname = *it; */
-  sexpr respval = std::move(*++it);
+    smtlib_output->sexpr_list.size() == query.size() &&
+    "Wrong number of responses to get-value from smtlib solver");
+
+  // Unpack our values from the response list, in the order they were asked
+  auto q = query.begin();
+  for (sexpr &response : smtlib_output->sexpr_list)
+  {
+    // Now we have a valuation pair. First is the symbol
+    assert(
+      response.sexpr_list.size() == 2 &&
+      "Expected 2 operands in "
+      "valuation_pair_list from smtlib solver");
+    model_values.emplace(*q++, std::move(response.sexpr_list.back()));
+  }
 
   delete smtlib_output;
-  return respval;
 }
 
 static BigInt interp_numeric(const sexpr &respval, bool is_signed)
@@ -682,7 +717,7 @@ static BigInt interp_numeric(const sexpr &respval, bool is_signed)
 
 BigInt smtlib_convt::get_bv(smt_astt a, bool is_signed)
 {
-  sexpr respval = get_value(a);
+  const sexpr &respval = get_value(a);
 
   // Attempt to read an integer.
   BigInt m = interp_numeric(respval, is_signed);
@@ -770,7 +805,7 @@ void smtlib_convt::file_emitter::flush() const
 
 tvt smtlib_convt::l_get(smt_astt a)
 {
-  sexpr second = get_value(a);
+  const sexpr &second = get_value(a);
 
   // And finally we have our value. It should be true or false.
   if (second.token == TOK_KW_TRUE)
@@ -1482,6 +1517,7 @@ void smtlib_convt::pop_ctx()
   // Wipe this level of symbol table.
   symbol_tablet::nth_index<1>::type &syms_numindex = symbol_table.get<1>();
   syms_numindex.erase(ctx_level);
+  model_values.clear();
 
   smt_convt::pop_ctx();
 }
@@ -4,6 +4,7 @@
 #include <list>
 #include <solvers/smt/smt_conv.h>
 #include <string>
+#include <unordered_map>
 #ifndef _WIN32
 #include <unistd.h>
 #endif
@@ -263,7 +264,12 @@ public:
   smt_astt
   convert_array_of(smt_astt init_val, unsigned long domain_width) override;
 
-  sexpr get_value(smt_astt a) const;
+  const sexpr &get_value(smt_astt a);
+  void fetch_values(const std::vector<smt_astt> &asts) override;
+  bool supports_batch_fetch() const override
+  {
+    return true;
+  }
 
   bool get_bool(smt_astt a) override;
   tvt l_get(smt_astt a) override;
@@ -358,6 +364,9 @@ public:
 
   symbol_tablet symbol_table;
 
+  /** Values of the current model received from the solver, by ast */
+  std::unordered_map<smt_astt, sexpr> model_values;
+
   static const std::string temp_prefix;
 
   struct external_process_died : std::runtime_error
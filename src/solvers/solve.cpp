@@ -125,8 +125,23 @@ smt_convt *create_solver(
   bool node_flat = options.get_bool_option("tuple-node-flattener");
   bool sym_flat = options.get_bool_option("tuple-sym-flattener");
   bool array_flat = options.get_bool_option("array-flattener");
+  bool array_lazy = options.get_bool_option("array-flattener-lazy");
   bool fp_to_bv = options.get_bool_option("fp2bv");
 
+  // Lazily encoded array constraints are only added while solving, so they
+  // would be missing from a formula that is written out instead.
+  if (
+    array_lazy &&
+    (options.get_bool_option("smt-formula-only") ||
+     (solver_name == "smtlib" &&
+      options.get_option("smtlib-solver-prog").empty())))
+  {
+    log_warning(
+      "--array-flattener-lazy has no effect when the formula is only "
+      "written out");
+    array_lazy = false;
+  }
+
   // Pick a tuple flattener to use. If the solver has native support, and no
   // options were given, use that by default
   if (tuple_api != nullptr && !node_flat && !sym_flat)
@@ -147,9 +162,9 @@ smt_convt *create_solver(
   if (array_api != nullptr && !array_flat)
     ctx->set_array_iface(array_api);
   else if (array_flat)
-    ctx->set_array_iface(new array_convt(ctx));
+    ctx->set_array_iface(new array_convt(ctx, array_lazy));
   else
-    ctx->set_array_iface(new array_convt(ctx));
+    ctx->set_array_iface(new array_convt(ctx, array_lazy));
 
   if (fp_api == nullptr || fp_to_bv)
     ctx->set_fp_conv(new fp_convt(ctx));
@@ -89,6 +89,8 @@ smt_convt::resultt yices_convt::dec_solve()
   pre_solve();
 
   smt_status_t result = yices_check_context(yices_ctx, nullptr);
+  while (result == STATUS_SAT && refine_model())
+    result = yices_check_context(yices_ctx, nullptr);
   if (result == STATUS_SAT)
     return smt_convt::P_SATISFIABLE;
 
@@ -87,6 +87,8 @@ smt_convt::resultt z3_convt::dec_solve()
   pre_solve();
 
   z3::check_result result = solver.check();
+  while (result == z3::sat && refine_model())
+    result = solver.check();
 
   if (result == z3::sat)
     return P_SATISFIABLE;
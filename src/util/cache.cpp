@@ -1,8 +1,11 @@
 #include <util/cache.h>
 #include <util/message.h>
+#include <util/perf_report.h>
 #include <utility>
 #include <util/crypto_hash.h>
 
+static perf_countert cache_hits("assertion-cache-hits");
+
 void assertion_cache::run_on_assert(symex_target_equationt::SSA_stept &step)
 {
   ++total;
@@ -16,6 +19,7 @@ void assertion_cache::run_on_assert(symex_target_equationt::SSA_stept &step)
 
 bool assertion_cache::run(symex_target_equationt::SSA_stepst &eq)
 {
+  perf_phaset phase("assertion-cache");
   fine_timet algorithm_start = current_time();
   for (auto &step : eq)
     run_on_step(step);
@@ -25,5 +29,7 @@ bool assertion_cache::run(symex_target_equationt::SSA_stepst &eq)
     time2string(algorithm_stop - algorithm_start),
     hits,
     total);
+
+  cache_hits.add(hits.to_uint64());
   return true;
 }
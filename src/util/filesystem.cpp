@@ -142,4 +142,28 @@ void file_operations::create_path_and_write(
     boost::filesystem::create_directories(p.parent_path());
 
   std::ofstream(path).write(s, n);
-}
\ No newline at end of file
+}
+
+std::string file_operations::persistent_dir(
+  const std::string &dir,
+  const std::string &name,
+  const std::function<void(const std::string &)> &fill)
+{
+  using namespace boost::filesystem;
+  path dest = path(dir) / name;
+  if (is_directory(dest))
+    return dest.string();
+
+  create_directories(dir);
+  path tmp = unique_path(dest.string() + ".%%%%-%%%%.tmp");
+  create_directory(tmp);
+  fill(tmp.string());
+
+  boost::system::error_code ec;
+  rename(tmp, dest, ec);
+  // someone else was faster
+  if (ec)
+    remove_all(tmp, ec);
+
+  return dest.string();
+}
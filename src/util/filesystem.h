@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdio> /* FILE */
+#include <functional>
 #include <string>
 
 /**
@@ -109,4 +110,17 @@ tmp_path create_tmp_dir(const std::string &format = "esbmc.%%%%-%%%%-%%%%");
  * contents
  */
 void create_path_and_write(const std::string &path, const char *s, size_t n);
+
+/**
+ *  @brief Returns the directory `dir/name`, creating it on first use
+ *
+ * If the directory does not exist yet, `fill` is called on a fresh
+ * directory which is then renamed to `dir/name`. Thus, the directory is
+ * either absent or complete, even when several processes create it at the
+ * same time, and can be kept across runs.
+ */
+std::string persistent_dir(
+  const std::string &dir,
+  const std::string &name,
+  const std::function<void(const std::string &)> &fill);
 } // namespace file_operations
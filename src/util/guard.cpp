@@ -1,18 +1,111 @@
 #include <algorithm>
+#include <boost/functional/hash.hpp>
+#include <unordered_map>
+#include <unordered_set>
 #include <util/guard.h>
 #include <irep2/irep2_utils.h>
 #include <util/std_expr.h>
 
+namespace
+{
+struct node_keyt
+{
+  const void *parent;
+  expr2tc conjunct;
+
+  bool operator==(const node_keyt &other) const
+  {
+    return parent == other.parent && conjunct == other.conjunct;
+  }
+};
+
+struct node_key_hash
+{
+  size_t operator()(const node_keyt &key) const
+  {
+    size_t h = key.conjunct.crc();
+    boost::hash_combine(h, key.parent);
+    return h;
+  }
+};
+} // namespace
+
+guardt::node_ptrt
+guardt::extend(const node_ptrt &parent, const expr2tc &conjunct)
+{
+  // A dead parent's address may be reused, but then its children are dead
+  // too and their entries expired
+  static thread_local std::
+    unordered_map<node_keyt, std::weak_ptr<const nodet>, node_key_hash>
+      nodes;
+  static thread_local size_t sweep_at = 1024;
+
+  std::weak_ptr<const nodet> &entry = nodes[{parent.get(), conjunct}];
+  if (node_ptrt existing = entry.lock())
+    return existing;
+
+  auto n = std::make_shared<nodet>();
+  n->parent = parent;
+  n->conjunct = conjunct;
+  n->expr = parent ? and2tc(parent->expr, conjunct) : conjunct;
+  n->depth = parent ? parent->depth + 1 : 1;
+  entry = n;
+
+  if (nodes.size() >= sweep_at)
+  {
+    for (auto it = nodes.begin(); it != nodes.end();)
+      it = it->second.expired() ? nodes.erase(it) : std::next(it);
+    sweep_at = std::max<size_t>(1024, 2 * nodes.size());
+  }
+
+  return n;
+}
+
+const guardt::node_ptrt &
+guardt::common_ancestor(const node_ptrt &a, const node_ptrt &b)
+{
+  // A true guard has no node, and no ancestor in common with any other
+  if (!a)
+    return a;
+  if (!b)
+    return b;
+
+  const node_ptrt *x = &a, *y = &b;
+  while (*x && *y && (*x)->depth > (*y)->depth)
+    x = &(*x)->parent;
+  while (*x && *y && (*y)->depth > (*x)->depth)
+    y = &(*y)->parent;
+
+  while (*x != *y)
+  {
+    x = &(*x)->parent;
+    y = &(*y)->parent;
+  }
+
+  return *x;
+}
+
+guardt::guard_listt
+guardt::conjuncts_after(const nodet *node, const nodet *ancestor)
+{
+  guard_listt res;
+  for (; node != ancestor; node = node->parent.get())
+    res.push_back(node->conjunct);
+  std::reverse(res.begin(), res.end());
+  return res;
+}
+
+guardt::guard_listt guardt::conjuncts() const
+{
+  return conjuncts_after(node.get(), nullptr);
+}
+
 expr2tc guardt::as_expr() const
 {
   if (is_true())
     return gen_true_expr();
 
-  if (is_single_symbol())
-    return *guard_list.begin();
-
-  assert(!is_nil_expr(g_expr));
-  return g_expr;
+  return node->expr;
 }
 
 void guardt::add(const expr2tc &expr)
@@ -32,22 +125,7 @@ void guardt::add(const expr2tc &expr)
     return;
   }
 
-  guard_list.push_back(expr);
-
-  // Update the chain of ands
-
-  // Easy case, there is no g_expr
-  if (is_nil_expr(g_expr))
-  {
-    assert(guard_list.size() == 1);
-    g_expr = expr;
-  }
-  else
-  {
-    // Otherwise, just update the chain of ands
-    expr2tc new_g_expr = and2tc(g_expr, expr);
-    g_expr.swap(new_g_expr);
-  }
+  node = extend(node, expr);
 }
 
 void guardt::guard_expr(expr2tc &dest) const
@@ -66,61 +144,47 @@ void guardt::guard_expr(expr2tc &dest) const
   dest = implies2tc(as_expr(), dest);
 }
 
-void guardt::build_guard_expr()
+void guardt::append(const guardt &guard)
 {
-  // This method closely related to guardt::add and guardt::guard_expr
-  // We need to build the chain of ands, to avoid memory bloat on as_expr
-
-  // This method will only be used, when the guard is nil, for instance,
-  // guardt &operator -= and guardt &operator |=, all other cases should
-  // be handled by guardt::add
-  assert(is_nil_expr(g_expr));
-
-  // if the guard is true, we don't need to build it
   if (is_true())
-    return;
-
-  // the expression is the single symbol in case the list just has this one
-  if (is_single_symbol())
   {
-    g_expr = *guard_list.begin();
+    node = guard.node;
     return;
   }
 
-  // We can assume at least two operands
-  auto it = guard_list.begin();
-
-  expr2tc arg1, arg2;
-  arg1 = *it++;
-  arg2 = *it++;
-  expr2tc res = and2tc(arg1, arg2);
-  while (it != guard_list.end())
-    res = and2tc(res, *it++);
-
-  g_expr.swap(res);
+  for (auto const &it : guard.conjuncts())
+    add(it);
 }
 
-void guardt::append(const guardt &guard)
+/// Elements of a that are (not) in b, in the order of a
+static guardt::guard_listt
+filter(const guardt::guard_listt &a, const guardt::guard_listt &b, bool in_b)
 {
-  for (auto const &it : guard.guard_list)
-    add(it);
+  std::unordered_set<expr2tc, irep2_hash> b_set(b.begin(), b.end());
+  guardt::guard_listt res;
+  for (const expr2tc &e : a)
+    if (b_set.count(e) == (size_t)in_b)
+      res.push_back(e);
+  return res;
 }
 
 guardt &operator-=(guardt &g1, const guardt &g2)
 {
-  guardt::guard_listt diff;
-  std::set_difference(
-    g1.guard_list.begin(),
-    g1.guard_list.end(),
-    g2.guard_list.begin(),
-    g2.guard_list.end(),
-    std::back_inserter(diff));
-
-  // Clear g1 and build the guard's list and expr
-  g1.clear();
+  // Easy cases: nothing to remove, or nothing to remove from
+  if (g2.is_true() || g1.is_true())
+    return g1;
+
+  // Everything up to the common ancestor is in both
+  const guardt::nodet *ancestor =
+    guardt::common_ancestor(g1.node, g2.node).get();
+  guardt::guard_listt diff = filter(
+    guardt::conjuncts_after(g1.node.get(), ancestor),
+    guardt::conjuncts_after(g2.node.get(), ancestor),
+    false);
 
-  g1.guard_list.swap(diff);
-  g1.build_guard_expr();
+  g1.clear();
+  for (const expr2tc &e : diff)
+    g1.node = guardt::extend(g1.node, e);
 
   return g1;
 }
@@ -140,7 +204,7 @@ guardt &operator|=(guardt &g1, const guardt &g2)
   {
     // Both guards have one symbol, so check if we opposite symbols, e.g,
     // g1 == sym1 and g2 == !sym1
-    expr2tc or_expr = or2tc(*g1.guard_list.begin(), *g2.guard_list.begin());
+    expr2tc or_expr = or2tc(g1.node->conjunct, g2.node->conjunct);
     simplify(or_expr);
 
     if (::is_true(or_expr))
@@ -161,36 +225,30 @@ guardt &operator|=(guardt &g1, const guardt &g2)
     // res = g1 || g2 = (!guard3 && !guard2 && !guard1) || (guard2 && !guard1)
 
     // Simplify equation: everything that's common in both guards, will not
-    // be or'd
-
-    // Common guards
+    // be or'd. That is the chain up to their common ancestor, plus whatever
+    // both added after it.
     guardt common;
-    std::set_intersection(
-      g1.guard_list.begin(),
-      g1.guard_list.end(),
-      g2.guard_list.begin(),
-      g2.guard_list.end(),
-      std::back_inserter(common.guard_list));
-    common.build_guard_expr();
+    common.node = guardt::common_ancestor(g1.node, g2.node);
+    guardt::guard_listt tail1 =
+      guardt::conjuncts_after(g1.node.get(), common.node.get());
+    guardt::guard_listt tail2 =
+      guardt::conjuncts_after(g2.node.get(), common.node.get());
+    for (const expr2tc &e : filter(tail1, tail2, true))
+      common.node = guardt::extend(common.node, e);
 
     // New g1 and g2, without the common guards
-    guardt new_g1;
-    std::set_difference(
-      g1.guard_list.begin(),
-      g1.guard_list.end(),
-      common.guard_list.begin(),
-      common.guard_list.end(),
-      std::back_inserter(new_g1.guard_list));
-    new_g1.build_guard_expr();
-
-    guardt new_g2;
-    std::set_difference(
-      g2.guard_list.begin(),
-      g2.guard_list.end(),
-      common.guard_list.begin(),
-      common.guard_list.end(),
-      std::back_inserter(new_g2.guard_list));
-    new_g2.build_guard_expr();
+    guardt new_g1, new_g2;
+    for (const expr2tc &e : filter(tail1, tail2, false))
+      new_g1.node = guardt::extend(new_g1.node, e);
+    for (const expr2tc &e : filter(tail2, tail1, false))
+      new_g2.node = guardt::extend(new_g2.node, e);
+
+    // One implies the other, the disjunction is what they have in common
+    if (new_g1.is_true() || new_g2.is_true())
+    {
+      g1.swap(common);
+      return g1;
+    }
 
     // Get the and expression from both guards
     expr2tc or_expr = or2tc(new_g1.as_expr(), new_g2.as_expr());
@@ -199,7 +257,7 @@ guardt &operator|=(guardt &g1, const guardt &g2)
     if (new_g1.is_single_symbol() && new_g2.is_single_symbol())
       simplify(or_expr);
 
-    g1.clear_append(common);
+    g1.swap(common);
     g1.add(or_expr);
   }
 
@@ -208,20 +266,27 @@ guardt &operator|=(guardt &g1, const guardt &g2)
 
 void guardt::dump() const
 {
-  for (auto const &it : guard_list)
+  for (auto const &it : conjuncts())
     it->dump();
 }
 
 bool operator==(const guardt &g1, const guardt &g2)
 {
-  // Very simple: the guard list should be identical.
-  return g1.guard_list == g2.guard_list;
+  // The chains must have the same conjuncts. Shared nodes are equal chains.
+  const guardt::nodet *a = g1.node.get(), *b = g2.node.get();
+  if (!a || !b || a->depth != b->depth)
+    return a == b;
+
+  for (; a != b; a = a->parent.get(), b = b->parent.get())
+    if (a->conjunct != b->conjunct)
+      return false;
+
+  return true;
 }
 
 void guardt::swap(guardt &g)
 {
-  guard_list.swap(g.guard_list);
-  g_expr.swap(g.g_expr);
+  node.swap(g.node);
 }
 
 bool guardt::disjunction_may_simplify(const guardt &other_guard) const
@@ -243,16 +308,16 @@ bool guardt::disjunction_may_simplify(const guardt &other_guard) const
 
 bool guardt::is_true() const
 {
-  return guard_list.empty();
+  return !node;
 }
 
 bool guardt::is_false() const
 {
   // Never false
-  if (guard_list.size() != 1)
+  if (!is_single_symbol())
     return false;
 
-  return (*guard_list.begin() == gen_false_expr());
+  return ::is_false(node->conjunct);
 }
 
 void guardt::make_true()
@@ -267,13 +332,12 @@ void guardt::make_false()
 
 bool guardt::is_single_symbol() const
 {
-  return (guard_list.size() == 1);
+  return node && node->depth == 1;
 }
 
 void guardt::clear()
 {
-  guard_list.clear();
-  g_expr.reset();
+  node.reset();
 }
 
 void guardt::clear_append(const guardt &guard)
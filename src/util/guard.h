@@ -3,8 +3,23 @@
 
 #include <util/expr.h>
 #include <irep2/irep2.h>
+#include <memory>
 #include <util/migrate.h>
 
+/**
+ * @brief A conjunction of conditions, e.g. the path condition of a state
+ *
+ * Guards are chains of immutable nodes, each adding one conjunct to the chain
+ * of its parent. Guards extended from the same guard share its nodes, so
+ * copying a guard and adding a conjunct to it take constant time. Nodes are
+ * hash-consed per thread: adding the same conjunct to the same node yields the
+ * same node, so guards built alike share their common prefix and the
+ * difference of two guards only walks the nodes after it.
+ *
+ * Each node holds the conjunction of its chain as an expression built on top
+ * of its parent's, so every prefix is a single shared expression which the
+ * SMT conversion caches and converts once.
+ */
 class guardt
 {
 public:
@@ -19,6 +34,9 @@ public:
   expr2tc as_expr() const;
   void guard_expr(expr2tc &dest) const;
 
+  /// The conjuncts, in the order they were added
+  guard_listt conjuncts() const;
+
   bool disjunction_may_simplify(const guardt &other_guard) const;
   bool is_true() const;
   bool is_false() const;
@@ -34,15 +52,36 @@ public:
   void dump() const;
 
 protected:
-  guard_listt guard_list;
-  expr2tc g_expr;
+  struct nodet;
+  typedef std::shared_ptr<const nodet> node_ptrt;
+
+  struct nodet
+  {
+    /// The rest of the chain, nullptr if this is the first conjunct
+    node_ptrt parent;
+    expr2tc conjunct;
+    /// Conjunction of the whole chain
+    expr2tc expr;
+    /// Number of conjuncts in the chain
+    size_t depth;
+  };
+
+  /// Last node of the chain, nullptr if the guard is true
+  node_ptrt node;
+
+  /// The node adding conjunct to parent
+  static node_ptrt extend(const node_ptrt &parent, const expr2tc &conjunct);
+  /// The last node that both chains share
+  static const node_ptrt &
+  common_ancestor(const node_ptrt &a, const node_ptrt &b);
+  /// The conjuncts of the chain after ancestor, in the order they were added
+  static guard_listt
+  conjuncts_after(const nodet *node, const nodet *ancestor);
 
   bool is_single_symbol() const;
   void clear();
   void clear_append(const guardt &guard);
   void clear_insert(const expr2tc &expr);
-
-  void build_guard_expr();
 };
 
 #endif
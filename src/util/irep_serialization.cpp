@@ -32,16 +32,13 @@ void irep_serializationt::reference_convert(std::istream &in, irept &irep)
 {
   unsigned id = read_long(in);
 
-  if (
-    ireps_container.ireps_on_read.find(id) !=
-    ireps_container.ireps_on_read.end())
-  {
-    irep = ireps_container.ireps_on_read[id];
-  }
+  auto it = ireps_container.ireps_on_read.find(id);
+  if (it != ireps_container.ireps_on_read.end())
+    irep = it->second;
   else
   {
     read_irep(in, irep);
-    ireps_container.ireps_on_read[id] = irep;
+    ireps_container.ireps_on_read.emplace(id, irep);
   }
 }
 
@@ -18,6 +18,12 @@ public:
   // parse file
   virtual bool parse(const std::string &path) = 0;
 
+  // whether parse() may run concurrently with parse() of other instances
+  virtual bool thread_safe_parse() const
+  {
+    return false;
+  }
+
   // add external dependencies of a given module to set
   virtual void dependencies()
   {
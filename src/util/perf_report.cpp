@@ -0,0 +1,173 @@
+#if defined(_WIN32) && !defined(__MINGW32__)
+#include <process.h>
+#define getpid _getpid
+#else
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+#include <fstream>
+#include <nlohmann/json.hpp>
+#include <util/message.h>
+#include <util/perf_report.h>
+
+bool perf_reportt::is_enabled = false;
+std::string perf_reportt::output;
+int perf_reportt::owner = 0;
+std::chrono::steady_clock::time_point perf_reportt::start;
+std::mutex perf_reportt::lock;
+std::vector<perf_reportt::phaset> perf_reportt::phases;
+std::unordered_map<std::string, size_t> perf_reportt::phase_index;
+
+/// Name of the innermost phase running on this thread
+static thread_local std::string current_phase;
+
+void perf_reportt::enable(const std::string &file)
+{
+  output = file;
+  owner = getpid();
+  start = std::chrono::steady_clock::now();
+  is_enabled = true;
+}
+
+double perf_reportt::cpu_time()
+{
+#if defined(_WIN32) && !defined(__MINGW32__)
+  return 0;
+#else
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec +
+         (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+#endif
+}
+
+uint64_t perf_reportt::peak_rss()
+{
+#if defined(_WIN32) && !defined(__MINGW32__)
+  return 0;
+#else
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+  // In bytes rather than KiB
+  return usage.ru_maxrss / 1024;
+#else
+  return usage.ru_maxrss;
+#endif
+#endif
+}
+
+std::vector<const perf_countert *> &perf_reportt::counters()
+{
+  static std::vector<const perf_countert *> counters;
+  return counters;
+}
+
+size_t perf_reportt::find_phase(const std::string &name)
+{
+  std::lock_guard<std::mutex> guard(lock);
+  auto [it, inserted] = phase_index.emplace(name, phases.size());
+  if (inserted)
+  {
+    phases.emplace_back();
+    phases.back().name = name;
+  }
+
+  return it->second;
+}
+
+void perf_reportt::add_phase(const std::string &name, double wall, double cpu)
+{
+  if (!is_enabled)
+    return;
+
+  uint64_t rss = peak_rss();
+  size_t index = find_phase(name);
+
+  std::lock_guard<std::mutex> guard(lock);
+  phaset &phase = phases[index];
+  phase.calls++;
+  phase.wall += wall;
+  phase.cpu += cpu;
+  phase.peak_rss = rss;
+}
+
+void perf_reportt::write(std::ostream &out, int exit_code)
+{
+  std::chrono::duration<double> wall = std::chrono::steady_clock::now() - start;
+
+  std::lock_guard<std::mutex> guard(lock);
+
+  nlohmann::ordered_json report;
+  report["exit_code"] = exit_code;
+  report["total"] = {
+    {"wall", wall.count()}, {"cpu", cpu_time()}, {"peak_rss", peak_rss()}};
+
+  report["phases"] = nlohmann::ordered_json::array();
+  for (const phaset &phase : phases)
+    report["phases"].push_back(
+      {{"name", phase.name},
+       {"calls", phase.calls},
+       {"wall", phase.wall},
+       {"cpu", phase.cpu},
+       {"peak_rss", phase.peak_rss}});
+
+  report["counters"] = nlohmann::ordered_json::object();
+  for (const perf_countert *counter : counters())
+  {
+    nlohmann::ordered_json &total = report["counters"][counter->name];
+    uint64_t value = counter->value.load(std::memory_order_relaxed);
+    total = total.is_null() ? value : total.get<uint64_t>() + value;
+  }
+
+  out << report.dump(2) << "\n";
+}
+
+void perf_reportt::write(int exit_code)
+{
+  if (!is_enabled || getpid() != owner)
+    return;
+
+  std::ofstream out(output);
+  if (!out)
+  {
+    log_error("Failed to open performance report file `{}'", output);
+    return;
+  }
+
+  write(out, exit_code);
+}
+
+perf_countert::perf_countert(const char *name) : name(name)
+{
+  std::lock_guard<std::mutex> guard(perf_reportt::lock);
+  perf_reportt::counters().push_back(this);
+}
+
+perf_phaset::perf_phaset(const char *name) : active(perf_reportt::enabled())
+{
+  if (!active)
+    return;
+
+  parent_length = current_phase.size();
+  if (parent_length)
+    current_phase += '/';
+  current_phase += name;
+  perf_reportt::find_phase(current_phase);
+
+  wall_start = std::chrono::steady_clock::now();
+  cpu_start = perf_reportt::cpu_time();
+}
+
+perf_phaset::~perf_phaset()
+{
+  if (!active)
+    return;
+
+  std::chrono::duration<double> wall =
+    std::chrono::steady_clock::now() - wall_start;
+  perf_reportt::add_phase(
+    current_phase, wall.count(), perf_reportt::cpu_time() - cpu_start);
+  current_phase.resize(parent_length);
+}
@@ -0,0 +1,133 @@
+#ifndef CPROVER_UTIL_PERF_REPORT_H
+#define CPROVER_UTIL_PERF_REPORT_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Collects where a run spends its time and memory, to be written as
+ * JSON with --perf-report
+ *
+ * A phase records how often it ran, the wall and CPU time spent in it and
+ * the peak resident set size of the process when it last finished. Phases
+ * started while another one is running on the same thread are named after
+ * it, e.g. "goto-programs/inline". Counters are named totals, such as the
+ * number of SSA steps, see perf_countert.
+ *
+ * Nothing is recorded unless the report was enabled, so instrumenting a
+ * phase costs a single branch otherwise.
+ */
+class perf_countert;
+
+class perf_reportt
+{
+public:
+  static void enable(const std::string &file);
+
+  static bool enabled()
+  {
+    return is_enabled;
+  }
+
+  /// Record a run of the phase called name
+  static void add_phase(const std::string &name, double wall, double cpu);
+
+  /// Write the report to the file it was enabled with. Only the process that
+  /// enabled it writes, not the children it forked.
+  static void write(int exit_code);
+  static void write(std::ostream &out, int exit_code);
+
+  /// Time spent by the process on the CPU so far, in seconds
+  static double cpu_time();
+  /// Peak resident set size of the process so far, in KiB
+  static uint64_t peak_rss();
+
+protected:
+  friend class perf_phaset;
+  friend class perf_countert;
+
+  struct phaset
+  {
+    std::string name;
+    uint64_t calls = 0;
+    double wall = 0;
+    double cpu = 0;
+    uint64_t peak_rss = 0;
+  };
+
+  /// Index of the phase called name, which is added if it is new
+  static size_t find_phase(const std::string &name);
+
+  static bool is_enabled;
+  static std::string output;
+  static int owner;
+  static std::chrono::steady_clock::time_point start;
+
+  static std::mutex lock;
+  /// In the order they first started
+  static std::vector<phaset> phases;
+  static std::unordered_map<std::string, size_t> phase_index;
+  /// In the order they were first reached. Counters may be constructed
+  /// during static initialisation, so this is a function-local static.
+  static std::vector<const perf_countert *> &counters();
+};
+
+/**
+ * @brief A counter of the performance report
+ *
+ * Counters are meant to be static objects at the place that counts, e.g.
+ *
+ *   static perf_countert hits("simplify-cache-hits");
+ *   hits.add();
+ *
+ * so a counter is registered once and counting is a relaxed atomic add, or
+ * just a branch when the report is disabled. Counters sharing a name are
+ * reported as one.
+ */
+class perf_countert
+{
+public:
+  explicit perf_countert(const char *name);
+
+  perf_countert(const perf_countert &) = delete;
+  perf_countert &operator=(const perf_countert &) = delete;
+
+  void add(uint64_t n = 1)
+  {
+    if (perf_reportt::enabled())
+      value.fetch_add(n, std::memory_order_relaxed);
+  }
+
+protected:
+  friend class perf_reportt;
+
+  const char *name;
+  std::atomic<uint64_t> value{0};
+};
+
+/**
+ * @brief Records the enclosing scope as a phase of the performance report
+ */
+class perf_phaset
+{
+public:
+  explicit perf_phaset(const char *name);
+  ~perf_phaset();
+
+  perf_phaset(const perf_phaset &) = delete;
+  perf_phaset &operator=(const perf_phaset &) = delete;
+
+protected:
+  bool active;
+  size_t parent_length = 0;
+  std::chrono::steady_clock::time_point wall_start;
+  double cpu_start = 0;
+};
+
+#endif
@@ -1,19 +1,101 @@
 #include <climits>
 #include <cstring>
+#include <unordered_map>
 #include <util/arith_tools.h>
 #include <util/base_type.h>
 #include <util/c_types.h>
 #include <util/expr_util.h>
+#include <util/perf_report.h>
 #include <irep2/irep2.h>
 #include <irep2/irep2_utils.h>
 #include <util/type_byte_size.h>
 
+static perf_countert simplify_calls("simplify-calls");
+static perf_countert normal_form_hits("simplify-normal-form-hits");
+static perf_countert cache_lookups("simplify-cache-lookups");
+static perf_countert cache_hits("simplify-cache-hits");
+
 expr2tc expr2t::do_simplify() const
 {
   return expr2tc();
 }
 
+namespace
+{
+/// Results of simplify_shared, by node, during the outermost simplification
+/// running on this thread. Each entry holds on to its node, so the node can
+/// neither be freed nor modified in place while it is cached; the cache is
+/// cleared as soon as the outermost simplification returns.
+thread_local std::unordered_map<const expr2t *, std::pair<expr2tc, expr2tc>>
+  simplify_cache;
+thread_local unsigned simplify_depth = 0;
+const size_t simplify_cache_limit = 1 << 16;
+
+/// Marks a simplification as running for the lifetime of the object
+class simplify_scopet
+{
+public:
+  simplify_scopet()
+  {
+    simplify_depth++;
+  }
+
+  ~simplify_scopet()
+  {
+    if (--simplify_depth == 0)
+      simplify_cache.clear();
+  }
+};
+} // namespace
+
 expr2tc expr2t::simplify() const
+{
+  simplify_calls.add();
+  if (simplified)
+  {
+    normal_form_hits.add();
+    return expr2tc();
+  }
+
+  simplify_scopet scope;
+  expr2tc res = simplify_once();
+  if (is_nil_expr(res))
+    simplified = true;
+
+  return res;
+}
+
+expr2tc simplify_shared(const expr2tc &expr)
+{
+  const expr2t *e = expr.get();
+  if (e->simplified)
+  {
+    normal_form_hits.add();
+    return expr2tc();
+  }
+
+  simplify_scopet scope;
+  cache_lookups.add();
+  auto it = simplify_cache.find(e);
+  if (it != simplify_cache.end())
+  {
+    cache_hits.add();
+    return it->second.second;
+  }
+
+  expr2tc res = e->simplify();
+  // Nothing to remember otherwise, the node itself is marked
+  if (!is_nil_expr(res))
+  {
+    if (simplify_cache.size() >= simplify_cache_limit)
+      simplify_cache.clear();
+    simplify_cache.emplace(e, std::make_pair(expr, res));
+  }
+
+  return res;
+}
+
+expr2tc expr2t::simplify_once() const
 {
   try
   {
@@ -35,7 +117,7 @@ expr2tc expr2t::simplify() const
       // Woot, we simplified some of this. It may have _additional_ fields that
       // need to get simplified (member2ts in arrays for example), so invoke the
       // simplifier again, to hit those potential subfields.
-      expr2tc res2 = res->simplify();
+      expr2tc res2 = res.simplify();
 
       // If we simplified even further, return res2; otherwise res.
       if (is_nil_expr(res2))
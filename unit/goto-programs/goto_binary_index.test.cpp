@@ -0,0 +1,123 @@
+/*******************************************************************\
+
+Module: Unit tests of indexed goto binaries
+
+\*******************************************************************/
+
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+#include <goto-programs/goto_binary_index.h>
+#include <goto-programs/read_goto_binary.h>
+#include <sstream>
+#include <util/c_types.h>
+
+static symbolt make_symbol(const irep_idt &id, const typet &type)
+{
+  symbolt s;
+  s.id = id;
+  s.name = id;
+  s.mode = "C";
+  s.type = type;
+  return s;
+}
+
+SCENARIO("Indexed goto binaries", "[core][goto-programs][goto-binary]")
+{
+  GIVEN("A context where one symbol refers to another")
+  {
+    contextt context;
+    symbolt x = make_symbol("c:@x", int_type());
+    symbolt y = make_symbol("c:@y", int_type());
+    y.value = symbol_exprt("c:@x", int_type());
+    symbolt z = make_symbol("c:@z", int_type());
+    context.add(x);
+    context.add(y);
+    context.add(z);
+
+    goto_functionst functions;
+    std::ostringstream out;
+    REQUIRE_FALSE(write_goto_binary_index(out, context, functions));
+    std::string data = out.str();
+
+    goto_binary_indext index;
+    REQUIRE_FALSE(index.open(data.data(), data.size()));
+
+    THEN("All symbols are listed with their dependencies")
+    {
+      REQUIRE(index.symbol_count() == 3);
+      REQUIRE(index.function_count() == 0);
+
+      for (unsigned i = 0; i < index.symbol_count(); i++)
+      {
+        const irep_idt &name = index.symbol_name(i);
+        if (name == "c:@y")
+        {
+          REQUIRE(index.symbol_deps(i).size() == 1);
+          REQUIRE(index.symbol_name(index.symbol_deps(i)[0]) == "c:@x");
+        }
+        else
+          REQUIRE(index.symbol_deps(i).empty());
+      }
+    }
+
+    THEN("Symbols are read back unchanged")
+    {
+      for (unsigned i = 0; i < index.symbol_count(); i++)
+      {
+        symbolt s;
+        index.read_symbol(i, s);
+        const symbolt *orig = context.find_symbol(index.symbol_name(i));
+        REQUIRE(orig);
+        REQUIRE(s.id == orig->id);
+        REQUIRE(s.type == orig->type);
+        REQUIRE(s.value == orig->value);
+      }
+    }
+
+    THEN("Truncated data is rejected")
+    {
+      goto_binary_indext truncated;
+      REQUIRE(truncated.open(data.data(), 10));
+    }
+  }
+
+  GIVEN("A function with a body")
+  {
+    contextt context;
+    code_typet type;
+    type.return_type() = empty_typet();
+    symbolt f = make_symbol("c:@F@f", type);
+    context.add(f);
+
+    goto_functionst functions;
+    goto_functiont &fn = functions.function_map["c:@F@f"];
+    fn.body_available = true;
+    goto_programt::targett jump = fn.body.add_instruction(GOTO);
+    fn.body.add_instruction(SKIP);
+    goto_programt::targett end = fn.body.add_instruction(END_FUNCTION);
+    jump->targets.push_back(end);
+
+    std::ostringstream out;
+    REQUIRE_FALSE(write_goto_binary_index(out, context, functions));
+    std::string data = out.str();
+
+    THEN("It is read back with its jump targets")
+    {
+      contextt new_context;
+      goto_functionst new_functions;
+      REQUIRE_FALSE(read_goto_binary_array(
+        data.data(), data.size(), new_context, new_functions));
+
+      REQUIRE(new_context.find_symbol("c:@F@f"));
+      auto it = new_functions.function_map.find("c:@F@f");
+      REQUIRE(it != new_functions.function_map.end());
+      REQUIRE(it->second.body_available);
+
+      const goto_programt &body = it->second.body;
+      REQUIRE(body.instructions.size() == 3);
+      REQUIRE(body.instructions.front().is_goto());
+      REQUIRE(body.instructions.front().targets.size() == 1);
+      REQUIRE(body.instructions.front().targets.front()->is_end_function());
+    }
+  }
+}
@@ -7,6 +7,7 @@
 
  Test Plan:
    - Bounded loop unroller.
+   - Loop accelerator.
  \*******************************************************************/
 
 #define CATCH_CONFIG_MAIN // This tells Catch to provide a main() - only do this in one cpp file
@@ -117,3 +118,134 @@ SCENARIO("the loop unroller detects bounded loops", "[algorithms]")
     REQUIRE(unwind_loops.get_number_of_bounded_loops() == 2);
   }
 }
+
+// ** Loop accelerator
+// Check whether the object summarises counting loops properly
+
+SCENARIO("the loop accelerator summarises counting loops", "[algorithms]")
+{
+  GIVEN("A counting loop with an affine accumulator")
+  {
+    std::istringstream src(
+      "int main() { "
+      "  int n = nondet_int(); "
+      "  int x = 0; "
+      "  for(int i = 0; i < n; i++) x += 2; "
+      "  return x; "
+      "}");
+    program P = goto_factory::get_goto_functions(src);
+    auto &goto_functions = P.functions;
+    loop_accelerator accelerate(P.context);
+    accelerate.run(goto_functions);
+
+    REQUIRE(accelerate.get_number_of_loops() == 1);
+    REQUIRE(accelerate.get_number_of_accelerated_loops() == 1);
+
+    // The loop is gone
+    bounded_loop_unroller unwind_loops;
+    unwind_loops.run(goto_functions);
+    REQUIRE(unwind_loops.get_number_of_loops() == 0);
+  }
+  GIVEN("A counting loop accumulating the counter")
+  {
+    std::istringstream src(
+      "int main() { "
+      "  int sum = 0; "
+      "  for(int i = 0; i < 5; i++) sum += i; "
+      "  return sum; "
+      "}");
+    program P = goto_factory::get_goto_functions(src);
+    auto &goto_functions = P.functions;
+    loop_accelerator accelerate(P.context);
+    accelerate.run(goto_functions);
+
+    REQUIRE(accelerate.get_number_of_loops() == 1);
+    REQUIRE(accelerate.get_number_of_accelerated_loops() == 0);
+  }
+  GIVEN("A counting loop with control-flow")
+  {
+    std::istringstream src(
+      "int main() { "
+      "  int a = 0; "
+      "  for(int i = 0; i < 5; i++) if(nondet_int()) a++; "
+      "  return a; "
+      "}");
+    program P = goto_factory::get_goto_functions(src);
+    auto &goto_functions = P.functions;
+    loop_accelerator accelerate(P.context);
+    accelerate.run(goto_functions);
+
+    REQUIRE(accelerate.get_number_of_loops() == 1);
+    REQUIRE(accelerate.get_number_of_accelerated_loops() == 0);
+  }
+  GIVEN("A counting loop advancing a pointer")
+  {
+    std::istringstream src(
+      "int main() { "
+      "  int a[8]; "
+      "  int *p = a; "
+      "  for(int i = 0; i < 8; i++) p += 1; "
+      "  return *p; "
+      "}");
+    program P = goto_factory::get_goto_functions(src);
+    auto &goto_functions = P.functions;
+    loop_accelerator accelerate(P.context);
+    accelerate.run(goto_functions);
+
+    REQUIRE(accelerate.get_number_of_loops() == 1);
+    REQUIRE(accelerate.get_number_of_accelerated_loops() == 0);
+  }
+  GIVEN("A counting loop with an accumulator whose address is taken")
+  {
+    std::istringstream src(
+      "int main() { "
+      "  int n = nondet_int(); "
+      "  int x = 0; "
+      "  int *p = &x; "
+      "  for(int i = 0; i < n; i++) x += 2; "
+      "  return *p; "
+      "}");
+    program P = goto_factory::get_goto_functions(src);
+    auto &goto_functions = P.functions;
+    loop_accelerator accelerate(P.context);
+    accelerate.run(goto_functions);
+
+    REQUIRE(accelerate.get_number_of_loops() == 1);
+    REQUIRE(accelerate.get_number_of_accelerated_loops() == 0);
+  }
+  GIVEN("A counting loop with a limit read from memory")
+  {
+    std::istringstream src(
+      "int main() { "
+      "  int n = nondet_int(); "
+      "  int *p = &n; "
+      "  int x = 0; "
+      "  for(int i = 0; i < *p; i++) x += 2; "
+      "  return x; "
+      "}");
+    program P = goto_factory::get_goto_functions(src);
+    auto &goto_functions = P.functions;
+    loop_accelerator accelerate(P.context);
+    accelerate.run(goto_functions);
+
+    REQUIRE(accelerate.get_number_of_loops() == 1);
+    REQUIRE(accelerate.get_number_of_accelerated_loops() == 0);
+  }
+  GIVEN("A counting loop with a counter wider than its accumulator")
+  {
+    std::istringstream src(
+      "int main() { "
+      "  long long n = nondet_int(); "
+      "  int x = 0; "
+      "  for(long long i = 0; i < n; i++) x += 2; "
+      "  return x; "
+      "}");
+    program P = goto_factory::get_goto_functions(src);
+    auto &goto_functions = P.functions;
+    loop_accelerator accelerate(P.context);
+    accelerate.run(goto_functions);
+
+    REQUIRE(accelerate.get_number_of_loops() == 1);
+    REQUIRE(accelerate.get_number_of_accelerated_loops() == 0);
+  }
+}
@@ -3,6 +3,7 @@
 #include <irep2/irep2.h>
 #include <irep2/irep2_utils.h>
 #include <util/crypto_hash.h>
+#include <utility>
 
 namespace
 {
@@ -115,3 +116,61 @@ SCENARIO("irep2 hashing", "[core][irep2]")
     }
   }
 }
+
+SCENARIO("irep2 simplification memoisation", "[core][irep2]")
+{
+  type2tc t = get_uint_type(32);
+  expr2tc x = symbol2tc(t, "x");
+  expr2tc y = symbol2tc(t, "y");
+
+  GIVEN("An expression with nothing to simplify")
+  {
+    expr2tc e = add2tc(t, x, y);
+    REQUIRE(is_nil_expr(e.simplify()));
+
+    THEN("It is marked as simplified")
+    {
+      REQUIRE(std::as_const(e)->simplified);
+      REQUIRE(is_nil_expr(e.simplify()));
+    }
+    THEN("Modifying it clears the mark")
+    {
+      to_add2t(e).side_2 = gen_zero(t);
+      REQUIRE(!std::as_const(e)->simplified);
+      REQUIRE(e.simplify() == x);
+    }
+  }
+  GIVEN("A simplifiable subterm shared by two expressions")
+  {
+    expr2tc shared = mul2tc(t, add2tc(t, x, gen_zero(t)), gen_one(t));
+    expr2tc e1 = add2tc(t, shared, y);
+    expr2tc e2 = sub2tc(t, shared, y);
+
+    THEN("Both simplify as if it was not shared")
+    {
+      expr2tc r1 = e1;
+      expr2tc r2 = e2;
+      REQUIRE(simplify(r1));
+      REQUIRE(simplify(r2));
+      REQUIRE(r1 == add2tc(t, x, y));
+      REQUIRE(r2 == sub2tc(t, x, y));
+      REQUIRE(simplify_shared(shared) == x);
+    }
+    THEN("Separate simplifications agree without sharing a cache")
+    {
+      expr2tc r1 = e1;
+      REQUIRE(simplify(r1));
+      expr2tc r2 = e1;
+      REQUIRE(simplify(r2));
+      REQUIRE(r1 == r2);
+      REQUIRE(simplify_shared(shared) == simplify_shared(shared));
+    }
+    THEN("The originals are left untouched")
+    {
+      expr2tc r1 = e1;
+      simplify(r1);
+      REQUIRE(to_add2t(e1).side_1 == shared);
+      REQUIRE(is_mul2t(to_add2t(e1).side_1));
+    }
+  }
+}
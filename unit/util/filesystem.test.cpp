@@ -8,6 +8,7 @@ Author: Rafael Sá Menezes
 #include <catch2/catch.hpp>
 #include <util/filesystem.h>
 #include <boost/filesystem.hpp>
+#include <fstream>
 
 TEST_CASE(
   "tmp path should be unique between two runs",
@@ -62,3 +63,21 @@ TEST_CASE("tmp file is file and should be removed", "[core][util][filesystem]")
   }
   REQUIRE(!boost::filesystem::exists(path));
 }
+
+TEST_CASE(
+  "persistent dir is filled once and kept",
+  "[core][util][filesystem]")
+{
+  auto cache = file_operations::create_tmp_dir("esbmc-test-%%%%");
+  unsigned filled = 0;
+  auto fill = [&filled](const std::string &dir) {
+    filled++;
+    std::ofstream(dir + "/file") << "contents";
+  };
+
+  std::string first = file_operations::persistent_dir(cache.path(), "d", fill);
+  std::string second = file_operations::persistent_dir(cache.path(), "d", fill);
+  REQUIRE(first == second);
+  REQUIRE(filled == 1);
+  REQUIRE(boost::filesystem::is_regular_file(first + "/file"));
+}
@@ -0,0 +1,114 @@
+#define CATCH_CONFIG_MAIN // This tells Catch to provide a main() - only do this in one cpp file
+#include <catch2/catch.hpp>
+#include <irep2/irep2_utils.h>
+#include <util/guard.h>
+
+namespace
+{
+expr2tc sym(const std::string &name)
+{
+  return symbol2tc(get_bool_type(), name);
+}
+
+guardt make_guard(const std::vector<expr2tc> &conjuncts)
+{
+  guardt g;
+  for (const expr2tc &e : conjuncts)
+    g.add(e);
+  return g;
+}
+} // namespace
+
+SCENARIO("guards are conjunctions", "[core][util][guard]")
+{
+  expr2tc a = sym("a"), b = sym("b"), c = sym("c"), d = sym("d");
+
+  GIVEN("An empty guard")
+  {
+    guardt g;
+    REQUIRE(g.is_true());
+    REQUIRE(::is_true(g.as_expr()));
+
+    THEN("Adding conjuncts builds their conjunction in order")
+    {
+      g.add(a);
+      g.add(gen_true_expr());
+      g.add(and2tc(b, c));
+      REQUIRE(g.conjuncts() == guardt::guard_listt{a, b, c});
+      REQUIRE(g.as_expr() == and2tc(and2tc(a, b), c));
+    }
+    THEN("Adding false makes it false")
+    {
+      g.add(a);
+      g.add(gen_false_expr());
+      g.add(b);
+      REQUIRE(g.is_false());
+    }
+  }
+  GIVEN("Guards extended from a common guard")
+  {
+    guardt common = make_guard({a, b});
+    guardt g1 = common, g2 = common;
+    g1.add(c);
+    g2.add(not2tc(c));
+
+    THEN("They share its conjunction")
+    {
+      REQUIRE(
+        to_and2t(g1.as_expr()).side_1.get() ==
+        to_and2t(g2.as_expr()).side_1.get());
+    }
+    THEN("Guards built alike are equal")
+    {
+      REQUIRE(g1 == make_guard({a, b, c}));
+      REQUIRE(!(g1 == g2));
+      REQUIRE(!(g1 == common));
+    }
+    THEN("The difference is what was added after the common guard")
+    {
+      guardt diff = g1;
+      diff -= g2;
+      REQUIRE(diff.conjuncts() == guardt::guard_listt{c});
+
+      diff = g1;
+      diff -= common;
+      REQUIRE(diff.conjuncts() == guardt::guard_listt{c});
+
+      diff = common;
+      diff -= g1;
+      REQUIRE(diff.is_true());
+    }
+    THEN("The difference with a true guard is the other guard or true")
+    {
+      guardt diff = g1;
+      diff -= guardt();
+      REQUIRE(diff == g1);
+
+      diff = guardt();
+      diff -= g1;
+      REQUIRE(diff.is_true());
+    }
+    THEN("The disjunction keeps the common guard")
+    {
+      guardt g = g1;
+      g |= g2;
+      REQUIRE(g == common);
+
+      guardt g3 = make_guard({a, b, d});
+      g = g1;
+      g |= g3;
+      REQUIRE(g.conjuncts() == guardt::guard_listt{a, b, or2tc(c, d)});
+    }
+  }
+  GIVEN("Guards whose conjuncts differ in order")
+  {
+    guardt g1 = make_guard({a, b, c});
+    guardt g2 = make_guard({a, c, d});
+
+    THEN("The difference drops every conjunct of the other")
+    {
+      g1 -= g2;
+      REQUIRE(g1.conjuncts() == guardt::guard_listt{b});
+    }
+  }
+}